@@ -2,87 +2,70 @@
 #include <stdlib.h>
 #include <mpi.h>
 #include <string.h>
-
-#define N 9
-
-// Fonction pour trouver la première case vide
-int find_empty(int grid[N][N], int *row, int *col) {
-    for (*row = 0; *row < N; (*row)++)
-        for (*col = 0; *col < N; (*col)++)
-            if (grid[*row][*col] == 0)
-                return 1;
-    return 0;
-}
-
-// Fonction pour vérifier si un nombre peut être placé dans une case
-int isSafe(int grid[N][N], int row, int col, int num) {
-    for (int x = 0; x < N; x++)
-        if (grid[row][x] == num) return 0;
-
-    for (int x = 0; x < N; x++)
-        if (grid[x][col] == num) return 0;
-
-    int startRow = row - row % 3;
-    int startCol = col - col % 3;
-    for (int i = 0; i < 3; i++)
-        for (int j = 0; j < 3; j++)
-            if (grid[i + startRow][j + startCol] == num)
-                return 0;
-    return 1;
+#include <stddef.h>
+#include "../Solveur/sudoku_core.h"
+#include "../Solveur/lecture.h"
+
+#define MSG_BATCH 64      // Grilles par message
+#define PIPELINE 2        // Lots en vol par worker (double tampon)
+#define MASTER_BATCH 4    // Grilles résolues par le maître quand il est inoccupé
+#define TAG_WORK 0
+#define TAG_STOP 1
+
+// Message échangé dans les deux sens : un lot de grilles consécutives (à
+// résoudre, ou résolues). Seules les count premières grilles sont envoyées.
+typedef struct {
+    int first;                        // Indice de la première grille du lot
+    int count;
+    PackedGrid grids[MSG_BATCH];
+} GridBatch;
+
+static inline int batchBytes(const GridBatch *batch) {
+    return (int)(offsetof(GridBatch, grids) + batch->count * sizeof(PackedGrid));
 }
 
-// Fonction de résolution Sudoku (backtracking)
-int solveSudoku(int grid[N][N]) {
-    int row, col;
-    
-    if (!find_empty(grid, &row, &col))
-        return 1;
-
-    for (int num = 1; num <= 9; num++) {
-        if (isSafe(grid, row, col, num)) {
-            grid[row][col] = num;
-            if (solveSudoku(grid))
-                return 1;
-            grid[row][col] = 0;
-        }
-    }
-    return 0;
-}
-
-// Fonction pour charger les grilles depuis un fichier
-int load_grids(const char* filename, int grids[][N][N], int max_grids) {
-    FILE* file = fopen(filename, "r");
-    if (!file) {
+// Charge toutes les grilles du fichier (lecture en flux, sans limite). Le
+// tableau est alloué par la fonction.
+int load_grids(const char* filename, Grid **grids) {
+    GridReader reader;
+    *grids = NULL;
+    if (!readerOpen(&reader, filename)) {
         perror("Erreur lors de l'ouverture du fichier");
         return 0;
     }
 
-    char line[100];
-    int count = 0;
-
-    while (fgets(line, sizeof(line), file) && count < max_grids) {
-        if (strstr(line, "Grille") != NULL) {
-            // Lire les 9 lignes suivantes pour la grille
-            for (int i = 0; i < N; i++) {
-                fgets(line, sizeof(line), file);
-                for (int j = 0; j < N; j++) {
-                    char c = line[j * 2]; // Chiffres séparés par des espaces
-                    grids[count][i][j] = (c == '.' || c == ' ') ? 0 : c - '0';
-                }
-            }
-            count++;
+    int count = 0, capacity = 0;
+    for (;;) {
+        if (count + READ_CHUNK > capacity) {
+            capacity = capacity ? 2 * capacity : READ_CHUNK;
+            Grid *grown = realloc(*grids, capacity * sizeof(Grid));
+            if (!grown) break;
+            *grids = grown;
         }
+        int n = readerChunk(&reader, *grids + count, READ_CHUNK);
+        if (n == 0) break;
+        count += n;
     }
 
-    fclose(file);
+    readerClose(&reader);
     return count;
 }
 
+// Prépare le lot commençant à la grille first ; renvoie l'indice de la
+// première grille non distribuée
+int fill_batch(GridBatch *batch, const Grid grids[], int first, int num_grids) {
+    batch->first = first;
+    batch->count = num_grids - first < MSG_BATCH ? num_grids - first : MSG_BATCH;
+    for (int i = 0; i < batch->count; i++)
+        gridPack(&grids[first + i], &batch->grids[i]);
+    return first + batch->count;
+}
+
 // Fonction pour afficher une grille
-void print_grid(int grid[N][N]) {
+void print_grid(const Grid *grid) {
     for (int i = 0; i < N; i++) {
         for (int j = 0; j < N; j++)
-            printf("%d ", grid[i][j]);
+            printf("%d ", grid->cells[i * N + j]);
         printf("\n");
     }
     printf("\n");
@@ -96,100 +79,141 @@ int main(int argc, char** argv) {
     MPI_Comm_size(MPI_COMM_WORLD, &size);
     double start = MPI_Wtime();
 
-    const int max_grids = 100;
-    int grids[max_grids][N][N];
-    int num_grids = 0;
-
     if (rank == 0) { // Master
         // Charger les grilles depuis le fichier
-        num_grids = load_grids("sudoku_grids.txt", grids, max_grids);
+        const char *filename = argc > 1 ? argv[1] : "sudoku_grids.txt";
+        Grid *grids = NULL;
+        int num_grids = load_grids(filename, &grids);
         if (num_grids == 0) {
             MPI_Abort(MPI_COMM_WORLD, 1);
         }
-        printf("%d grilles chargées depuis sudoku_grids.txt\n", num_grids);
-    }
-
-    // Diffuser le nombre de grilles à tous les processus
-    MPI_Bcast(&num_grids, 1, MPI_INT, 0, MPI_COMM_WORLD);
-
-    // Diffuser toutes les grilles
-    MPI_Bcast(grids, num_grids * N * N, MPI_INT, 0, MPI_COMM_WORLD);
-
-    if (rank == 0) { // Master
-        int solved_grids[max_grids][N][N];
-        int next_grid = 0;
-        MPI_Status status;
-
-        // Distribuer les grilles initiales aux workers
-        for (int i = 1; i < size && next_grid < num_grids; i++) {
-            MPI_Send(&next_grid, 1, MPI_INT, i, 0, MPI_COMM_WORLD);
-            MPI_Send(grids[next_grid], N * N, MPI_INT, i, 0, MPI_COMM_WORLD);
-            next_grid++;
+        printf("%d grilles chargées depuis %s\n", num_grids, filename);
+
+        // Les workers ne reçoivent que leurs lots : pas de diffusion des grilles.
+        // Chaque worker a PIPELINE lots en vol : un emplacement (envoi + réception
+        // du résultat) par lot.
+        int workers = size - 1, slots = workers * PIPELINE;
+        GridBatch *out = malloc(slots * sizeof(GridBatch));
+        GridBatch *in = malloc(slots * sizeof(GridBatch));
+        MPI_Request *send_req = malloc(slots * sizeof(MPI_Request));
+        MPI_Request *recv_req = malloc(slots * sizeof(MPI_Request));
+        int next_grid = 0, outstanding = 0;
+        STAT_COMM_BEGIN(comm_start);
+
+        for (int k = 0; k < slots; k++) {
+            int worker = 1 + k / PIPELINE;
+            send_req[k] = recv_req[k] = MPI_REQUEST_NULL;
+            if (next_grid >= num_grids) continue;
+            next_grid = fill_batch(&out[k], grids, next_grid, num_grids);
+            MPI_Isend(&out[k], batchBytes(&out[k]), MPI_BYTE, worker, TAG_WORK, MPI_COMM_WORLD, &send_req[k]);
+            MPI_Irecv(&in[k], sizeof(GridBatch), MPI_BYTE, worker, TAG_WORK, MPI_COMM_WORLD, &recv_req[k]);
+            outstanding++;
         }
 
-        // Recevoir les solutions et distribuer les grilles restantes
-        while (next_grid < num_grids) {
-            int recv_grid[N][N];
-            int grid_index;
-            
-            MPI_Recv(&grid_index, 1, MPI_INT, MPI_ANY_SOURCE, 0, MPI_COMM_WORLD, &status);
-            MPI_Recv(recv_grid, N * N, MPI_INT, status.MPI_SOURCE, 0, MPI_COMM_WORLD, &status);
-            
-            memcpy(solved_grids[grid_index], recv_grid, N * N * sizeof(int));
-            
-            MPI_Send(&next_grid, 1, MPI_INT, status.MPI_SOURCE, 0, MPI_COMM_WORLD);
-            MPI_Send(grids[next_grid], N * N, MPI_INT, status.MPI_SOURCE, 0, MPI_COMM_WORLD);
-            next_grid++;
+        // Recevoir les solutions et renvoyer un lot sur le même emplacement ;
+        // entre deux résultats, le maître résout lui-même quelques grilles
+        while (outstanding > 0 || next_grid < num_grids) {
+            int k = MPI_UNDEFINED, flag = 0;
+            if (outstanding > 0)
+                MPI_Testany(slots, recv_req, &k, &flag, MPI_STATUS_IGNORE);
+            if (!flag || k == MPI_UNDEFINED) {
+                if (next_grid < num_grids) {
+                    int count = num_grids - next_grid < MASTER_BATCH ? num_grids - next_grid : MASTER_BATCH;
+                    STAT_CLOCK(busy_start);
+                    for (int i = 0; i < count; i++)
+                        solveGrid(&grids[next_grid + i]);
+                    STAT_ELAPSED(busy, busy_start);
+                    next_grid += count;
+                    continue;
+                }
+                MPI_Waitany(slots, recv_req, &k, MPI_STATUS_IGNORE);
+            }
+            outstanding--;
+            for (int i = 0; i < in[k].count; i++)
+                gridUnpack(&in[k].grids[i], &grids[in[k].first + i]);
+
+            if (next_grid < num_grids) {
+                MPI_Wait(&send_req[k], MPI_STATUS_IGNORE);  // Tampon d'envoi libre
+                next_grid = fill_batch(&out[k], grids, next_grid, num_grids);
+                int worker = 1 + k / PIPELINE;
+                MPI_Isend(&out[k], batchBytes(&out[k]), MPI_BYTE, worker, TAG_WORK, MPI_COMM_WORLD, &send_req[k]);
+                MPI_Irecv(&in[k], sizeof(GridBatch), MPI_BYTE, worker, TAG_WORK, MPI_COMM_WORLD, &recv_req[k]);
+                outstanding++;
+            }
         }
+        MPI_Waitall(slots, send_req, MPI_STATUSES_IGNORE);
 
         // Envoyer un signal de fin à tous les workers
         for (int i = 1; i < size; i++) {
-            MPI_Send(&i, 1, MPI_INT, i, 1, MPI_COMM_WORLD);
-        }
-
-        // Recevoir les dernières solutions
-        for (int i = 1; i < size; i++) {
-            int recv_grid[N][N];
-            int grid_index;
-            
-            MPI_Recv(&grid_index, 1, MPI_INT, MPI_ANY_SOURCE, 0, MPI_COMM_WORLD, &status);
-            MPI_Recv(recv_grid, N * N, MPI_INT, status.MPI_SOURCE, 0, MPI_COMM_WORLD, &status);
-            
-            memcpy(solved_grids[grid_index], recv_grid, N * N * sizeof(int));
+            MPI_Send(NULL, 0, MPI_BYTE, i, TAG_STOP, MPI_COMM_WORLD);
         }
+        STAT_COMM_END(comm_start);
 
         // Afficher toutes les grilles résolues
         printf("\n=== Solutions ===\n");
         for (int g = 0; g < num_grids; g++) {
             printf("Grille %d:\n", g + 1);
-            print_grid(solved_grids[g]);
+            print_grid(&grids[g]);
         }
+        free(out);
+        free(in);
+        free(send_req);
+        free(recv_req);
+        free(grids);
 
     } else { // Workers
-        while (1) {
-            int grid_index;
+        // Double tampon : le lot suivant arrive pendant que le courant est
+        // résolu, et le résultat précédent part pendant ce temps
+        GridBatch in[PIPELINE], out[PIPELINE];
+        MPI_Request recv_req[PIPELINE], send_req[PIPELINE];
+        STAT_COMM_BEGIN(comm_start);
+        for (int b = 0; b < PIPELINE; b++) {
+            MPI_Irecv(&in[b], sizeof(GridBatch), MPI_BYTE, 0, MPI_ANY_TAG, MPI_COMM_WORLD, &recv_req[b]);
+            send_req[b] = MPI_REQUEST_NULL;
+        }
+
+        for (int b = 0; ; b = (b + 1) % PIPELINE) {
             MPI_Status status;
-            
-            MPI_Probe(0, MPI_ANY_TAG, MPI_COMM_WORLD, &status);
-            if (status.MPI_TAG == 1) {
-                MPI_Recv(&grid_index, 1, MPI_INT, 0, 1, MPI_COMM_WORLD, &status);
-                break;
+            MPI_Wait(&recv_req[b], &status);
+            if (status.MPI_TAG == TAG_STOP) break;
+
+            MPI_Wait(&send_req[b], MPI_STATUS_IGNORE);  // Résultat précédent parti
+            out[b].first = in[b].first;
+            out[b].count = in[b].count;
+            STAT_CLOCK(busy_start);
+            for (int i = 0; i < in[b].count; i++) {
+                Grid grid;
+                gridUnpack(&in[b].grids[i], &grid);
+                solveGrid(&grid);
+                gridPack(&grid, &out[b].grids[i]);
             }
+            STAT_ELAPSED(busy, busy_start);
+            MPI_Isend(&out[b], batchBytes(&out[b]), MPI_BYTE, 0, TAG_WORK, MPI_COMM_WORLD, &send_req[b]);
+            MPI_Irecv(&in[b], sizeof(GridBatch), MPI_BYTE, 0, MPI_ANY_TAG, MPI_COMM_WORLD, &recv_req[b]);
+        }
 
-            int grid[N][N];
-            MPI_Recv(&grid_index, 1, MPI_INT, 0, 0, MPI_COMM_WORLD, &status);
-            MPI_Recv(grid, N * N, MPI_INT, 0, 0, MPI_COMM_WORLD, &status);
-            
-            solveSudoku(grid);
-            
-            MPI_Send(&grid_index, 1, MPI_INT, 0, 0, MPI_COMM_WORLD);
-            MPI_Send(grid, N * N, MPI_INT, 0, 0, MPI_COMM_WORLD);
+        // Annuler les réceptions encore en attente
+        for (int b = 0; b < PIPELINE; b++) {
+            if (recv_req[b] != MPI_REQUEST_NULL) {
+                MPI_Cancel(&recv_req[b]);
+                MPI_Wait(&recv_req[b], MPI_STATUS_IGNORE);
+            }
         }
+        MPI_Waitall(PIPELINE, send_req, MPI_STATUSES_IGNORE);
+        STAT_COMM_END(comm_start);
     }
 
     double end = MPI_Wtime();
     printf("Temps total: %.6f secondes\n", end - start);
 
+    // Calcul et communication de chaque processus (compilation avec -DSEARCH_STATS)
+    if (STATS_ENABLED) {
+        SearchStats local;
+        memset(&local, 0, sizeof(local));
+        statsTake(&local);
+        statsReportRanks(&local, MPI_COMM_WORLD);
+    }
+
     MPI_Finalize();
     return 0;
-}
\ No newline at end of file
+}
@@ -4,63 +4,66 @@
 #include <mpi.h>
 #include <omp.h>
 #include <dirent.h>
+#include <sys/stat.h>
 #include <string.h>
 #include <time.h>
+#include "../Solveur/solveur.h"
+#include "../Solveur/frontiere.h"
+#include "../Solveur/lecture.h"
+#include "../Solveur/conteneur.h"
+#include "../Solveur/compteur_mpi.h"
+#include "../Solveur/memoire_mpi.h"
+#include "../Solveur/difficulte.h"
+#include "../Solveur/echeance.h"
 
-#define N 9               // Taille des sudoku
 #define TIME_LIMIT 5      // Limite de temps pour un sudoku
 #define MAX_FILES 100     // Nombre maximum de sudokus
 #define FNAME_SIZE 256    // Taille maximale d'un nom de fichier
+#define GRIDFILE_CHUNK 1024  // Grilles par paquet pris dans un conteneur
+#define HARD_PROBE_NODES 4096  // Budget avant découpage d'une grille difficile
 
-// Vérifie si num peut être placé en sans violer les règles
-bool isSafe(int grid[N][N], int row, int col, int num) {
-    for (int x = 0; x < N; x++) {
-        if (grid[row][x] == num || grid[x][col] == num)
-            return false;
-    }
-    int startRow = row - row % 3, startCol = col - col % 3;
-    for (int i = 0; i < 3; i++)
-        for (int j = 0; j < 3; j++)
-            if (grid[i + startRow][j + startCol] == num)
-                return false;
-    return true;
-}
+SolverBackend solver_backend = BACKEND_BACKTRACK;  // Option -a
+int frontier_depth = FRONTIER_MAX_DEPTH;           // Option -d
+int frontier_tasks = 0;                            // Option -t (0 = selon le nombre de threads)
 
-// Résolution séquentielle par backtracking
-bool solveSudokuSeq(int grid[N][N], int row, int col) {
-    if (row == N) return true;
-    if (col == N) return solveSudokuSeq(grid, row + 1, 0);
-    if (grid[row][col] != 0) return solveSudokuSeq(grid, row, col + 1);
-    for (int num = 1; num <= N; num++) {
-        if (isSafe(grid, row, col, num)) {
-            grid[row][col] = num;
-            if (solveSudokuSeq(grid, row, col + 1))
-                return true;
-            grid[row][col] = 0;
-        }
-    }
-    return false;
+// Résolution séquentielle avec le moteur choisi, arrêtée après timeLimit
+// secondes (0 : aucune limite). Renvoie 1 si la grille est résolue, 0 si elle
+// n'a pas de solution, -1 si le temps limite est atteint.
+int solveSudokuSeq(Grid *grid, double timeLimit) {
+    Board b;
+    if (!boardLoad(&b, grid)) return 0;
+    SearchControl ctl;
+    searchInit(&ctl, NULL);
+    searchSetTimeLimit(&ctl, timeLimit);
+    if (!boardSolveWith(&b, solver_backend, &ctl)) return ctl.stopped ? -1 : 0;
+    boardStore(&b, grid);
+    return 1;
 }
 
 // Affiche la grille 
-void printGrid(int grid[N][N]) {
+void printGrid(const Grid *grid) {
     for (int i = 0; i < N; i++){
         for (int j = 0; j < N; j++)
-            printf("%d ", grid[i][j]);
+            printf("%d ", grid->cells[i * N + j]);
         printf("\n");
     }
 }
 
-// Charge un sudoku depuis un fichier
-int loadSudokuFromFile(const char* filename, int grid[N][N]) {
+// Charge un sudoku depuis un fichier (conversion en Grid à la lecture)
+int loadSudokuFromFile(const char* filename, Grid *grid) {
     FILE *file = fopen(filename, "r");
     if (!file) {
         perror("Erreur ouverture fichier");
         return 0;
     }
-    for (int i = 0; i < N; i++)
-        for (int j = 0; j < N; j++)
-            fscanf(file, "%d", &grid[i][j]);
+    for (int idx = 0; idx < NN; idx++) {
+        int value;
+        if (fscanf(file, "%d", &value) != 1 || value < 0 || value > N) {
+            fclose(file);
+            return 0;
+        }
+        grid->cells[idx] = (uint8_t)value;
+    }
     fclose(file);
     return 1;
 }
@@ -84,67 +87,380 @@ int loadSudokusFromDirectory(const char* dir_path, char sudoku_files[][FNAME_SIZ
     return count;
 }
 
-//Résolution parallèle d'un sudoku :
-//- Repère la première case vide.
-//- Pour chaque candidat (1 à 9), lance en parallèle une branche (OpenMP)
-// qui effectue une copie locale de la grille et appelle la résolution séquentielle.
-//- Si une branche trouve une solution, on la copie dans grid.
-bool parallelSolveSudoku(int grid[N][N]) {
-    int firstRow = -1, firstCol = -1;
-    for (int i = 0; i < N && firstRow == -1; i++) {
-        for (int j = 0; j < N; j++) {
-            if (grid[i][j] == 0) { firstRow = i; firstCol = j; break; }
-        }
-    }
-    if (firstRow == -1)
-        return true;
-    
-    bool found = false;
-    int localGrid[N][N];
-    #pragma omp parallel for shared(found) firstprivate(localGrid)
-    for (int num = 1; num <= N; num++) {
-        if (found) continue;
-        if (isSafe(grid, firstRow, firstCol, num)) {
-            memcpy(localGrid, grid, sizeof(int)*N*N);
-            localGrid[firstRow][firstCol] = num;
-            if (solveSudokuSeq(localGrid, firstRow, firstCol + 1)) {
-                #pragma omp critical
-                {
-                    if (!found) {
-                        found = true;
-                        memcpy(grid, localGrid, sizeof(int)*N*N);
-                    }
+// Résout en parallèle les tâches de la frontière : les threads (OpenMP) se
+// les répartissent dynamiquement et les résolvent chacun sur une copie
+// locale ; la première solution trouvée est copiée dans grid. Renvoie 1 si
+// une solution a été trouvée, 0 s'il n'y en a pas, -1 si le temps limite
+// (secondes, 0 : aucun) a été atteint avant.
+int parallelSolveFrontier(Frontier *frontier, Grid *grid, double timeLimit) {
+    // Drapeau d'arrêt partagé : les branches en cours l'interrogent pendant
+    // leur recherche et abandonnent dès qu'une solution est trouvée
+    atomic_int found;
+    atomic_init(&found, 0);
+    int expired = 0;
+    double deadline = timeLimit > 0 ? monotonicSeconds() + timeLimit : 0.0;
+    int numTasks = frontierCount(frontier);
+    #pragma omp parallel for schedule(dynamic, 1) shared(found) reduction(|:expired)
+    for (int i = 0; i < numTasks; i++) {
+        if (atomic_load_explicit(&found, memory_order_relaxed)) continue;
+        Board local = *frontierTask(frontier, i);
+        SearchControl ctl;
+        searchInit(&ctl, &found);
+        ctl.deadline = deadline;
+        STAT_CLOCK(busyStart);
+        int solved = boardSolveWith(&local, solver_backend, &ctl);
+        STAT_ELAPSED(busy, busyStart);
+        if (solved) {
+            #pragma omp critical
+            {
+                if (!atomic_load(&found)) {
+                    boardStore(&local, grid);
+                    atomic_store(&found, 1);
                 }
             }
+        } else if (ctl.stopped && !atomic_load(&found)) {
+            expired = 1;  // Échéance atteinte : la branche n'a pas été épuisée
+        }
+    }
+    if (atomic_load(&found)) return 1;
+    return expired ? -1 : 0;
+}
+
+//Résolution parallèle d'un sudoku :
+//- Propage les singletons puis découpe la recherche en largeur jusqu'à avoir
+// assez de grilles partielles (ou atteindre la profondeur maximale).
+//- Les threads se partagent ces grilles (parallelSolveFrontier), avec un
+// temps limite vérifié pendant la recherche.
+// Renvoie 1 si la grille est résolue, 0 si elle n'a pas de solution, -1 si
+// le temps limite est atteint.
+int parallelSolveSudoku(Grid *grid, double timeLimit) {
+    Board board;
+    if (!boardLoad(&board, grid) || !boardPropagate(&board))
+        return 0;
+
+    int target = frontier_tasks > 0 ? frontier_tasks : FRONTIER_TASKS_PER_THREAD * omp_get_max_threads();
+    Frontier frontier;
+    frontierInit(&frontier);
+    if (!frontierExpand(&frontier, &board, frontier_depth, target)) {
+        frontierFree(&frontier);
+        return solveSudokuSeq(grid, timeLimit);
+    }
+    if (frontier.solved) {
+        boardStore(&frontier.solution, grid);
+        frontierFree(&frontier);
+        return 1;
+    }
+    int result = parallelSolveFrontier(&frontier, grid, timeLimit);
+    frontierFree(&frontier);
+    return result;
+}
+
+// Résout un paquet de grilles, une grille par thread, les plus difficiles
+// d'abord, sans qu'aucune ne dépasse TIME_LIMIT secondes.
+// - Une pré-passe (gridProbeSearch) tranche la plupart des grilles et garde
+//   la recherche interrompue des autres.
+// - Les autres, triées par score décroissant, sont reprises par tranches de
+//   budget croissant (echeance.h) : une grille facile ne reste pas bloquée
+//   derrière une difficile, et chaque tranche repart de l'état laissé par la
+//   précédente, éventuellement sur un autre thread.
+// - Quand il reste moins de grilles que de threads (ou une seule), chacune
+//   est découpée entre tous les threads à partir de son état
+//   (frontierFromSearch).
+// Les grilles qui atteignent TIME_LIMIT sont abandonnées et comptées dans
+// *abandoned.
+// La recherche reprise par tranches est celle du backtracking : avec -a dlx
+// (ou si la mémoire manque), chaque grille est résolue d'un seul tenant par
+// le moteur choisi, avec le même temps limite (solveSudokuSeq).
+long solveChunk(Grid *grids, int count, long *abandoned) {
+    long solved = 0, expired = 0;
+    int resumable = solver_backend == BACKEND_BACKTRACK;
+    float *scores = resumable ? malloc(count * sizeof(float)) : NULL;
+    int *order = resumable ? malloc(count * sizeof(int)) : NULL;
+    int *pending = resumable ? malloc(count * sizeof(int)) : NULL;
+    SearchJob *jobs = resumable ? malloc(count * sizeof(SearchJob)) : NULL;
+    if (!scores || !pending || !order || !jobs) {
+        free(scores);
+        free(pending);
+        free(order);
+        free(jobs);
+        #pragma omp parallel for schedule(dynamic, 16) reduction(+:solved, expired)
+        for (int i = 0; i < count; i++) {
+            STAT_CLOCK(busyStart);
+            int status = solveSudokuSeq(&grids[i], TIME_LIMIT);
+            STAT_ELAPSED(busy, busyStart);
+            solved += status > 0;
+            expired += status < 0;
+        }
+        *abandoned += expired;
+        return solved;
+    }
+
+    int numPending = 0;
+    #pragma omp parallel for schedule(dynamic, 16) reduction(+:solved)
+    for (int i = 0; i < count; i++) {
+        // Essai dans une recherche locale : seules les grilles qui résistent
+        // recopient leur état dans jobs[] (l'essai est négligeable en temps)
+        StackSearch probe;
+        STAT_CLOCK(busyStart);
+        int status = gridProbeSearch(&probe, &grids[i], PROBE_NODES, &scores[i]);
+        STAT_ELAPSED(busy, busyStart);
+        if (status >= 0) {
+            solved += status;
+            continue;
+        }
+        searchJobInit(&jobs[i], i);
+        jobs[i].search = probe;
+        int k;
+        #pragma omp atomic capture
+        k = numPending++;
+        pending[k] = i;
+    }
+    difficultySort(scores, pending, numPending, order);
+
+    // Tranches : pending[k] indique si order[k] reste à poursuivre
+    int threads = omp_get_max_threads();
+    unsigned long budget = HARD_PROBE_NODES;
+    while (numPending > 1 && numPending >= threads) {
+        #pragma omp parallel for schedule(dynamic, 1) reduction(+:solved, expired)
+        for (int k = 0; k < numPending; k++) {
+            SearchJob *job = &jobs[order[k]];
+            STAT_CLOCK(busyStart);
+            SearchStatus status = searchJobRun(job, budget, TIME_LIMIT);
+            STAT_ELAPSED(busy, busyStart);
+            pending[k] = 0;
+            if (status == SEARCH_SOLVED) {
+                boardStore(&job->search.board, &grids[job->index]);
+                solved++;
+            } else if (status == SEARCH_STOPPED) {
+                if (searchJobExpired(job, TIME_LIMIT)) expired++;
+                else pending[k] = 1;
+            }
         }
+        int kept = 0;
+        for (int k = 0; k < numPending; k++)
+            if (pending[k]) order[kept++] = order[k];
+        numPending = kept;
+        budget *= JOB_SLICE_GROWTH;
     }
-    return found;
+
+    // Dernières grilles : chacune découpée entre tous les threads là où sa
+    // recherche s'est arrêtée, avec le temps qui lui reste
+    for (int k = 0; k < numPending; k++) {
+        SearchJob *job = &jobs[order[k]];
+        Frontier frontier;
+        frontierInit(&frontier);
+        int status;
+        if (frontierFromSearch(&frontier, &job->search)) {
+            status = parallelSolveFrontier(&frontier, &grids[job->index], TIME_LIMIT - job->spent);
+        } else {
+            status = searchJobRun(job, 0, TIME_LIMIT);
+            if (status == SEARCH_SOLVED) boardStore(&job->search.board, &grids[job->index]);
+            else if (status == SEARCH_STOPPED) status = -1;
+        }
+        frontierFree(&frontier);
+        solved += status > 0;
+        expired += status < 0;
+    }
+    free(scores);
+    free(pending);
+    free(order);
+    free(jobs);
+    *abandoned += expired;
+    return solved;
+}
+
+// Résolution en flux d'un fichier de grilles (format 81 caractères par ligne
+// ou blocs "Grille N:") : le fichier est découpé en tranches de READ_BLOCK
+// octets, distribuées par le compteur partagé. Chaque processus n'analyse que
+// ses tranches (readerRange), par paquets d'au plus READ_CHUNK grilles.
+// Renvoie le nombre de grilles résolues localement, -1 si le fichier ne peut
+// pas être lu.
+long solveBulkFile(const char *path, WorkCounter *counter, long *localCount, long *abandoned) {
+    GridReader reader;
+    if (!readerOpen(&reader, path)) {
+        perror("Erreur ouverture fichier");
+        return -1;
+    }
+    Grid *chunk = malloc(READ_CHUNK * sizeof(Grid));
+    if (!chunk) {
+        readerClose(&reader);
+        return -1;
+    }
+
+    long solved = 0, blocks = readerBlocks(&reader);
+    *localCount = 0;
+    for (;;) {
+        STAT_CLOCK(commStart);
+        long block = workCounterNext(counter, 1);
+        STAT_ELAPSED(comm, commStart);
+        if (block >= blocks) break;
+        readerRange(&reader, block);
+        int count;
+        while ((count = readerChunk(&reader, chunk, READ_CHUNK)) > 0) {
+            *localCount += count;
+            solved += solveChunk(chunk, count, abandoned);
+        }
+    }
+    free(chunk);
+    readerClose(&reader);
+    return solved;
+}
+
+// Résolution d'un conteneur binaire (.sdkb) : chaque processus projette le
+// fichier et prend au compteur partagé des paquets de GRIDFILE_CHUNK grilles,
+// lues en place sans analyse ni diffusion. Renvoie le nombre de grilles
+// résolues localement, -1 si la mémoire manque.
+long solveGridFile(const GridFile *file, WorkCounter *counter, long *localCount, long *abandoned) {
+    Grid *chunk = malloc(GRIDFILE_CHUNK * sizeof(Grid));
+    if (!chunk) return -1;
+    long solved = 0;
+    *localCount = 0;
+    for (;;) {
+        STAT_CLOCK(commStart);
+        long first = workCounterNext(counter, GRIDFILE_CHUNK);
+        STAT_ELAPSED(comm, commStart);
+        if (first >= file->count) break;
+        long count = file->count - first < GRIDFILE_CHUNK ? file->count - first : GRIDFILE_CHUNK;
+        *localCount += count;
+        for (long i = 0; i < count; i++)
+            gridFileGet(file, first + i, &chunk[i]);
+        solved += solveChunk(chunk, (int)count, abandoned);
+    }
+    free(chunk);
+    return solved;
+}
+
+// Compteurs de recherche (compilation avec -DSEARCH_STATS) : threads du
+// processus 0, puis calcul et communication de chaque processus sur une phase
+// de durée localTime (collectif)
+void reportSearchStats(int rank, double localTime) {
+    int threads = omp_get_max_threads();
+    SearchStats *perThread = statsAlloc(threads);
+    if (!perThread) MPI_Abort(MPI_COMM_WORLD, 1);
+    statsGather(perThread, threads);
+    SearchStats local;
+    memset(&local, 0, sizeof(local));
+    for (int t = 0; t < threads; t++)
+        statsMerge(&local, &perThread[t]);
+    if (rank == 0)
+        statsReportThreads("threads du processus 0", perThread, threads, localTime);
+    local.busy = localTime - local.comm;
+    local.steal = 0.0;
+    statsReportRanks(&local, MPI_COMM_WORLD);
+    free(perThread);
 }
 
 int main(int argc, char* argv[]){
     int rank, size;
-    double commTime = 0.0; 
+    double commTime = 0.0;        // Toutes les communications MPI
+    double parCommTime = 0.0;     // Celles comprises dans la mesure parallèle
     MPI_Init(&argc, &argv);
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
     MPI_Comm_size(MPI_COMM_WORLD, &size);
     
-    char sudoku_files[MAX_FILES][FNAME_SIZE];
+    // Tous les processus lisent les mêmes options
+    if (argc < 2) {
+        if (rank == 0)
+            printf("Usage: %s <dossier_sudokus|fichier> [-a backtrack|dlx] [-d profondeur] [-t tâches]\n", argv[0]);
+        MPI_Finalize();
+        return 1;
+    }
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+            if (!parseBackend(argv[++i], &solver_backend)) {
+                if (rank == 0)
+                    printf("Moteur inconnu : %s\n", argv[i]);
+                MPI_Finalize();
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            frontier_depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            frontier_tasks = atoi(argv[++i]);
+        } else {
+            if (rank == 0)
+                printf("Option inconnue : %s\n", argv[i]);
+            MPI_Finalize();
+            return 1;
+        }
+    }
+    
+    // Un fichier (et non un dossier) : conteneur binaire découpé en tranches,
+    // ou fichier texte lu en flux
+    struct stat st;
+    if (stat(argv[1], &st) == 0 && S_ISREG(st.st_mode)) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double bulkStart = MPI_Wtime();
+        long localCount = 0, localAbandoned = 0, localSolved;
+        WorkCounter counter;
+        workCounterCreate(&counter, MPI_COMM_WORLD);
+        GridFile container;
+        if (gridFileOpen(&container, argv[1])) {
+            localSolved = solveGridFile(&container, &counter, &localCount, &localAbandoned);
+            gridFileClose(&container);
+        } else {
+            localSolved = solveBulkFile(argv[1], &counter, &localCount, &localAbandoned);
+        }
+        workCounterFree(&counter);
+        if (localSolved < 0) MPI_Abort(MPI_COMM_WORLD, 1);
+        double localTime = MPI_Wtime() - bulkStart;
+        if (STATS_ENABLED) reportSearchStats(rank, localTime);
+
+        long totals[3], locals[3] = {localSolved, localCount, localAbandoned};
+        double bulkTime = 0.0;
+        MPI_Reduce(locals, totals, 3, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+        MPI_Reduce(&localTime, &bulkTime, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+        if (rank == 0) {
+            printf("Grilles résolues : %ld/%ld\n", totals[0], totals[1]);
+            if (totals[2] > 0)
+                printf("Grilles abandonnées (plus de %d s) : %ld\n", TIME_LIMIT, totals[2]);
+            printf("Temps total (lecture comprise) : %.4f secondes\n", bulkTime);
+            if (bulkTime > 0)
+                printf("Débit : %.0f grilles/seconde\n", totals[1] / bulkTime);
+        }
+        MPI_Finalize();
+        return 0;
+    }
+
     int num_sudokus = 0;
     double tCommStart, tCommEnd;
+    Grid *loaded = NULL;
     
-    // Le processus 0 lit la liste des fichiers
+    // Le processus 0 lit la liste des fichiers et les grilles : ni les noms
+    // ni les grilles ne sont diffusés à tous les processus
     if (rank == 0) {
-        num_sudokus = loadSudokusFromDirectory(argv[1], sudoku_files, MAX_FILES);
+        static char sudoku_files[MAX_FILES][FNAME_SIZE];
+        int num_files = loadSudokusFromDirectory(argv[1], sudoku_files, MAX_FILES);
+        loaded = malloc((num_files > 0 ? num_files : 1) * sizeof(Grid));
+        for (int i = 0; i < num_files; i++) {
+            if (loadSudokuFromFile(sudoku_files[i], &loaded[num_sudokus]))
+                num_sudokus++;
+            else
+                printf("Erreur de lecture du fichier %s\n", sudoku_files[i]);
+        }
         if (num_sudokus == 0) {
             printf("Aucun fichier sudoku trouvé dans %s\n", argv[1]);
             MPI_Abort(MPI_COMM_WORLD, 1);
         }
     }
     
-    // Diffuser le nombre de fichiers et la liste complète 
+    // Une copie des grilles (entrées puis solutions) par nœud, en mémoire
+    // partagée ; seuls les chefs de nœud reçoivent les grilles
+    NodeComms nc;
+    nodeCommsCreate(&nc, MPI_COMM_WORLD);
     tCommStart = MPI_Wtime();
     MPI_Bcast(&num_sudokus, 1, MPI_INT, 0, MPI_COMM_WORLD);
-    MPI_Bcast(sudoku_files, MAX_FILES * FNAME_SIZE, MPI_CHAR, 0, MPI_COMM_WORLD);
+    MPI_Win gridsWin;
+    MPI_Aint sharedBytes = num_sudokus * (MPI_Aint)(sizeof(int) + 2 * sizeof(Grid));
+    int *order = nodeSharedAlloc(&nc, sharedBytes, &gridsWin);  // Ordre de traitement
+    Grid *input = (Grid *)(order + num_sudokus);
+    Grid *output = input + num_sudokus;
+    if (nc.leaders != MPI_COMM_NULL) {
+        if (rank == 0) memcpy(input, loaded, num_sudokus * sizeof(Grid));
+        memset(output, 0, num_sudokus * sizeof(Grid));
+        MPI_Bcast(input, num_sudokus * sizeof(Grid), MPI_BYTE, 0, nc.leaders);
+    }
+    nodeSync(&nc, gridsWin);
     tCommEnd = MPI_Wtime();
     commTime += (tCommEnd - tCommStart);
     
@@ -152,47 +468,95 @@ int main(int argc, char* argv[]){
     //Exécution séquentielle
     if (rank == 0) {
         for (int i = 0; i < num_sudokus; i++) {
-            int grid[N][N];
-            if (!loadSudokuFromFile(sudoku_files[i], grid)) {
-                printf("Erreur de lecture du fichier %s\n", sudoku_files[i]);
-                continue;
-            }
+            Grid grid = loaded[i];
             double tstart = omp_get_wtime();
-            bool solved = solveSudokuSeq(grid, 0, 0);
+            int solved = solveSudokuSeq(&grid, TIME_LIMIT);
             double tend = omp_get_wtime();
             double dt = tend - tstart;
-            if (!solved || dt > TIME_LIMIT) {
-                printf("%s non résolu (%.4f s).\n", sudoku_files[i], dt);
+            if (solved <= 0) {
+                printf("Grille %d %s (%.4f s).\n", i + 1, solved < 0 ? "abandonnée" : "non résolue", dt);
                 continue;
             }
             seqTotalTime += dt;
         }
         printf("Temps total séquentiel pour %d sudokus : %.4f secondes\n", num_sudokus, seqTotalTime);
+        free(loaded);
     }
     
     //Exécution parallèle
+    // Distribution dynamique : chaque processus prend la grille suivante au
+    // compteur partagé dès qu'il a fini la précédente, la lit dans la mémoire
+    // partagée du nœud et y écrit sa solution. Les grilles sont prises de la
+    // plus difficile à la plus facile, selon l'estimation du processus 0.
+    WorkCounter counter;
+    workCounterCreate(&counter, MPI_COMM_WORLD);
     MPI_Barrier(MPI_COMM_WORLD);
     double parStart = MPI_Wtime();
     
-    int localSolvedCount = 0;
-    for (int i = rank; i < num_sudokus; i += size) {
-        int grid[N][N];
-        if (!loadSudokuFromFile(sudoku_files[i], grid)) {
-            printf("Processus %d : Erreur de lecture du fichier %s\n", rank, sudoku_files[i]);
-            continue;
+    if (rank == 0) {
+        float *scores = malloc(num_sudokus * sizeof(float));
+        int *indices = malloc(num_sudokus * sizeof(int));
+        #pragma omp parallel for schedule(dynamic, 16)
+        for (int i = 0; i < num_sudokus; i++) {
+            Grid grid = input[i];
+            STAT_CLOCK(busyStart);
+            gridProbe(&grid, PROBE_NODES, &scores[i]);
+            STAT_ELAPSED(busy, busyStart);
+            indices[i] = i;
         }
+        difficultySort(scores, indices, num_sudokus, order);
+        free(scores);
+        free(indices);
+    }
+    tCommStart = MPI_Wtime();
+    if (nc.leaders != MPI_COMM_NULL)
+        MPI_Bcast(order, num_sudokus, MPI_INT, 0, nc.leaders);
+    nodeSync(&nc, gridsWin);
+    tCommEnd = MPI_Wtime();
+    commTime += (tCommEnd - tCommStart);
+    parCommTime += (tCommEnd - tCommStart);
+    STAT_ADD(comm, tCommEnd - tCommStart);
+    
+    for (;;) {
+        STAT_CLOCK(nextStart);
+        long k = workCounterNext(&counter, 1);
+        STAT_ELAPSED(comm, nextStart);
+        if (k >= num_sudokus) break;
+        int i = order[k];
+        Grid grid = input[i];
         double tstart = omp_get_wtime();
-        bool solved = parallelSolveSudoku(grid);
+        int solved = parallelSolveSudoku(&grid, TIME_LIMIT);
         double tend = omp_get_wtime();
         double dt = tend - tstart;
-        if (!solved || dt > TIME_LIMIT) {
-            printf("Processus %d : %s non résolu (%.4f s).\n", rank, sudoku_files[i], dt);
+        if (solved <= 0) {
+            printf("Processus %d : grille %d %s (%.4f s).\n", rank, i + 1,
+                   solved < 0 ? "abandonnée" : "non résolue", dt);
             continue;
         }
-        localSolvedCount++;
+        output[i] = grid;
     }
     double parEnd = MPI_Wtime();
+    workCounterFree(&counter);
     double localParTime = parEnd - parStart;
+    if (STATS_ENABLED) reportSearchStats(rank, localParTime);
+    
+    // Solutions rassemblées sur le processus 0 : chaque grille n'est résolue
+    // que sur un nœud, les autres ont des zéros à sa place
+    tCommStart = MPI_Wtime();
+    nodeSync(&nc, gridsWin);
+    if (nc.leaders != MPI_COMM_NULL)
+        MPI_Reduce(rank == 0 ? MPI_IN_PLACE : (void *)output, output, num_sudokus * NN,
+                   MPI_UNSIGNED_CHAR, MPI_MAX, 0, nc.leaders);
+    tCommEnd = MPI_Wtime();
+    commTime += (tCommEnd - tCommStart);
+    if (rank == 0) {
+        int solvedCount = 0;
+        for (int i = 0; i < num_sudokus; i++)
+            solvedCount += gridClues(&output[i]) == NN;
+        printf("Grilles résolues : %d/%d\n", solvedCount, num_sudokus);
+    }
+    nodeSharedFree(&gridsWin);
+    nodeCommsFree(&nc);
     
     // Mesure du temps de communication MPI pendant la réduction
     tCommStart = MPI_Wtime();
@@ -201,13 +565,18 @@ int main(int argc, char* argv[]){
     tCommEnd = MPI_Wtime();
     commTime += (tCommEnd - tCommStart);
     
+    // Seules les communications comprises entre parStart et parEnd (diffusion
+    // de l'ordre) font partie du temps parallèle : la distribution des grilles
+    // et la réduction des solutions sont mesurées à part et ne doivent pas en
+    // être retranchées. Le speedup porte sur le temps parallèle mesuré.
+    double parCommMax = 0.0;
+    MPI_Reduce(&parCommTime, &parCommMax, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
     if (rank == 0) {
-        double netParTime = parTotalTime - commTime;
-        printf("Temps total parallèle (brut) pour %d sudokus : %.4f secondes\n", num_sudokus, parTotalTime);
-        printf("Temps total de communication MPI              : %.4f secondes\n", commTime);
-        printf("Temps total parallèle (nettoye)               : %.4f secondes\n", netParTime);
-        if (seqTotalTime > 0)
-            printf("Speedup (séquentiel / parallèle net)          : %.4f\n", seqTotalTime / netParTime);
+        printf("Temps total parallèle pour %d sudokus         : %.4f secondes\n", num_sudokus, parTotalTime);
+        printf("  dont communications MPI                     : %.4f secondes\n", parCommMax);
+        printf("Communications MPI du processus 0 (total)     : %.4f secondes\n", commTime);
+        if (seqTotalTime > 0 && parTotalTime > 0)
+            printf("Speedup (séquentiel / parallèle)              : %.4f\n", seqTotalTime / parTotalTime);
     }
     
     MPI_Finalize();
@@ -3,16 +3,37 @@
 #include <omp.h>
 #include <string.h>
 #include <time.h>
+#include "../Solveur/solveur.h"
+#include "../Solveur/frontiere.h"
+#include "../Solveur/vol_travail.h"
+#include "../Solveur/taches.h"
+#include "../Solveur/lot_simd.h"
+#include "../Solveur/lecture.h"
+#include "../Solveur/difficulte.h"
+#include "../Solveur/cache_solutions.h"
 
-#define N 9
 #define SEQUENTIAL_RUN 0
 #define PARALLEL_RUN 1
+#define BATCH_RUN 2
+
+// Moteur de résolution choisi avec l'option -a
+SolverBackend solver_backend = BACKEND_BACKTRACK;
+// Découpage d'une grille en tâches (options -d et -t, 0 = selon le nombre de threads)
+int frontier_depth = FRONTIER_MAX_DEPTH;
+int frontier_tasks = 0;
+// Cache des solutions (options -c et -C), recréé pour chaque mesure : NULL
+// sans cache ou pendant la mesure par lots
+int use_cache = 0;
+const char *cache_file = NULL;
+SolutionCache *solution_cache = NULL;
 
 unsigned int thread_safe_rand(unsigned int* seed);
-int hasMinimumClues(int grid[N][N]);
-int isValidGrid(int grid[N][N]);
-int isSafe(int grid[N][N], int row, int col, int num);
-int solveSudoku(int grid[N][N], int row, int col);
+int hasMinimumClues(const Grid *grid);
+int isValidGrid(const Grid *grid);
+int solveSudoku(Grid *grid);
+int task_solve(Grid *grid);
+int cache_lookup(Grid *grid, CanonicalForm *form);
+void cache_store(const CanonicalForm *form, const Grid *grid, int solved);
 
 // Implémentation du générateur de nombres aléatoires thread-safe
 unsigned int thread_safe_rand(unsigned int* seed) {
@@ -20,151 +41,156 @@ unsigned int thread_safe_rand(unsigned int* seed) {
     return *seed;
 }
 
-void print(int arr[N][N]) {
+void print(const Grid *grid) {
     for (int i = 0; i < N; i++) {
         for (int j = 0; j < N; j++) {
-            printf("%d ", arr[i][j]);
+            printf("%d ", grid->cells[i * N + j]);
         }
         printf("\n");
     }
 }
 
-int isSafe(int grid[N][N], int row, int col, int num) {
-    // Vérification rapide des valeurs
-    if (num < 1 || num > N) return 0;
-    
-    // Cache la ligne et la colonne pour éviter les accès mémoire répétés
-    int box_row = row - row % 3;
-    int box_col = col - col % 3;
-    
-    // Vérification optimisée avec un tableau de flags
-    int flags[N + 1] = {0};  // +1 car on utilise les indices 1-9
-    
-    // Vérification ligne et colonne en un seul passage
-    for (int x = 0; x < N; x++) {
-        if (grid[row][x] == num || grid[x][col] == num) return 0;
-        flags[grid[row][x]] = 1;
-        flags[grid[x][col]] = 1;
-    }
-    
-    // Vérification de la sous-grille 3x3
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            if (grid[box_row + i][box_col + j] == num) return 0;
-        }
-    }
-    
-    return 1;
-}
-
-int solveSudoku(int grid[N][N], int row, int col) {
-    if (row == N - 1 && col == N) return 1;
-    if (col == N) { row++; col = 0; }
-    if (grid[row][col] > 0) return solveSudoku(grid, row, col + 1);
-
-    for (int num = 1; num <= N; num++) {
-        if (isSafe(grid, row, col, num)) {
-            grid[row][col] = num;
-            if (solveSudoku(grid, row, col + 1)) return 1;
-            grid[row][col] = 0;
-        }
-    }
-    return 0;
+int solveSudoku(Grid *grid) {
+    return solveGridWith(grid, solver_backend);
 }
 
-int parallel_solve(int grid[N][N]) {
+int parallel_solve(Grid *grid) {
     if (!hasMinimumClues(grid)) return 0;  // Vérification rapide
-    
-    int row = 0, col = 0;
-    while (row < N && grid[row][col] != 0) {
-        col++;
-        if (col == N) { col = 0; row++; }
-    }
-    if (row == N) return 1;
 
-    int found = 0;
-    int possible_nums[N];
-    int num_count = 0;
+    Board board;
+    if (!boardLoad(&board, grid)) return 0;  // Indices contradictoires
+    if (!boardPropagate(&board)) return 0;   // Déductions à la racine
 
-    for (int num = 1; num <= N; num++) {
-        if (isSafe(grid, row, col, num)) {
-            possible_nums[num_count++] = num;
-        }
+    // Déjà dans une région parallèle (une grille par thread) : pas de découpage
+    int threads = omp_in_parallel() ? 1 : omp_get_max_threads();
+    int target = frontier_tasks > 0 ? frontier_tasks : FRONTIER_TASKS_PER_THREAD * threads;
+    if (threads == 1) target = 1;
+
+    Frontier frontier;
+    frontierInit(&frontier);
+    if (!frontierExpand(&frontier, &board, frontier_depth, target)) {
+        // Mémoire insuffisante : résolution sans découpage
+        frontierFree(&frontier);
+        if (!boardSolveWith(&board, solver_backend, NULL)) return 0;
+        boardStore(&board, grid);
+        return 1;
+    }
+    if (frontier.solved) {
+        boardStore(&frontier.solution, grid);
+        frontierFree(&frontier);
+        return 1;
     }
 
-    if (num_count == 0) return 0;  // Aucune solution possible
-
-    #pragma omp parallel shared(found, grid)
-    {
-        int local_grid[N][N];
-        #pragma omp for schedule(dynamic, 1)
-        for (int i = 0; i < num_count; i++) {
-            if (!found) {
-                memcpy(local_grid, grid, sizeof(local_grid));
-                int num = possible_nums[i];
-                local_grid[row][col] = num;
-                if (solveSudoku(local_grid, row, col + 1)) {
-                    #pragma omp critical
-                    {
-                        if (!found) {
-                            memcpy(grid, local_grid, sizeof(local_grid));
-                            found = 1;
-                        }
-                    }
-                }
-            }
+    // Threads à vol de travail ; un seul thread (ou mémoire insuffisante) :
+    // les tâches sont résolues l'une après l'autre
+    Board solution;
+    int found = threads > 1 ? stealSolve(&frontier, solver_backend, threads, &solution) : -1;
+    if (found < 0) {
+        found = 0;
+        STAT_CLOCK(busy_start);
+        for (int i = 0; i < frontierCount(&frontier) && !found; i++) {
+            solution = *frontierTask(&frontier, i);
+            found = boardSolveWith(&solution, solver_backend, NULL);
         }
+        STAT_ELAPSED(busy, busy_start);
     }
+    if (found) boardStore(&solution, grid);
+    frontierFree(&frontier);
     return found;
 }
 
-void copyGrid(int src[N][N], int dest[N][N]) {
-    for(int i = 0; i < N; i++) {
-        for(int j = 0; j < N; j++) {
-            dest[i][j] = src[i][j];
-        }
-    }
-}
+// Résolution d'une grille depuis une tâche OpenMP : une grille difficile est
+// découpée en sous-tâches exécutées par la même équipe que les autres grilles
+int task_solve(Grid *grid) {
+    if (!hasMinimumClues(grid)) return 0;
 
-int isValidGrid(int grid[N][N]) {
-    for (int i = 0; i < N; i++) {
-        for (int j = 0; j < N; j++) {
-            if (grid[i][j] != 0) {
-                int temp = grid[i][j];
-                grid[i][j] = 0;
-                if (!isSafe(grid, i, j, temp)) {
-                    grid[i][j] = temp;
-                    return 0;
-                }
-                grid[i][j] = temp;
-            }
-        }
-    }
+    Board board, solution;
+    if (!boardLoad(&board, grid)) return 0;
+    if (!boardPropagate(&board)) return 0;
+    if (!taskSolveBoard(&board, solver_backend, frontier_depth, frontier_tasks, &solution)) return 0;
+    boardStore(&solution, grid);
     return 1;
 }
 
-int hasMinimumClues(int grid[N][N]) {
+// Consulte le cache avant une résolution. Renvoie 1 si la grille (ou une
+// grille équivalente) est déjà résolue, sa solution étant écrite en place, 0
+// si elle est connue sans solution, -1 sinon : *form sert alors à ajouter le
+// résultat avec cache_store, ou à consulter à nouveau le cache avec
+// cache_find sans recanoniser la grille.
+int cache_lookup(Grid *grid, CanonicalForm *form) {
+    if (!solution_cache) return -1;
+    gridCanonicalize(grid, form);
+    return cacheLookup(solution_cache, form, grid);
+}
+
+int cache_find(Grid *grid, const CanonicalForm *form) {
+    if (!solution_cache) return -1;
+    return cacheLookup(solution_cache, form, grid);
+}
+
+void cache_store(const CanonicalForm *form, const Grid *grid, int solved) {
+    if (solution_cache) cacheStore(solution_cache, form, solved ? grid : NULL);
+}
+
+void copyGrid(const Grid *src, Grid *dest) {
+    memcpy(dest->cells, src->cells, NN);
+}
+
+int isValidGrid(const Grid *grid) {
+    Board board;
+    return boardLoad(&board, grid);
+}
+
+int hasMinimumClues(const Grid *grid) {
     int count = 0;
-    for (int i = 0; i < N && count < 17; i++) {
-        for (int j = 0; j < N && count < 17; j++) {
-            if (grid[i][j] != 0) count++;
-        }
+    for (int idx = 0; idx < NN && count < 17; idx++) {
+        if (grid->cells[idx] != 0) count++;
     }
     return count >= 17;
 }
 
-double solve_grids(int (*grids)[N][N], int num_grids, int mode) {
+double solve_grids(Grid *grids, int num_grids, int mode) {
     int solved = 0;
     double min_time = 999999.0;
     double max_time = 0.0;
     int invalid_grids = 0;
+    int cache_hits = 0;
+
+    // Cache vide (ou amorcé avec le fichier de -C) pour chaque mesure, hors
+    // temps mesuré ; les lots SIMD ne le consultent pas. Seules les grilles
+    // qu'un court essai (gridProbe) ne tranche pas sont canonisées : une
+    // grille facile se résout plus vite qu'elle ne se canonise.
+    SolutionCache cache;
+    if (use_cache && mode != BATCH_RUN) {
+        long loaded = cacheOpen(&cache, num_grids, cache_file);
+        if (loaded < 0) {
+            printf("Erreur d'allocation mémoire (cache)\n");
+        } else {
+            solution_cache = &cache;
+            if (cache_file) printf("Cache : %ld grilles chargées depuis %s\n", loaded, cache_file);
+        }
+    }
     double start = omp_get_wtime();
     
     if (mode == SEQUENTIAL_RUN) {
         // Version séquentielle
         for(int g = 0; g < num_grids; g++) {
             double grid_start = omp_get_wtime();
-            if (parallel_solve(grids[g])) {
+            CanonicalForm form;
+            float score;
+            int status = -1;
+            if (!hasMinimumClues(&grids[g])) status = 0;
+            else if (solution_cache) status = gridProbe(&grids[g], PROBE_NODES, &score);
+            if (status < 0) {
+                status = cache_lookup(&grids[g], &form);
+                if (status < 0) {
+                    status = parallel_solve(&grids[g]);
+                    cache_store(&form, &grids[g], status);
+                } else {
+                    cache_hits++;
+                }
+            }
+            if (status) {
                 solved++;
             } else {
                 invalid_grids++;
@@ -173,26 +199,118 @@ double solve_grids(int (*grids)[N][N], int num_grids, int mode) {
             min_time = grid_time < min_time ? grid_time : min_time;
             max_time = grid_time > max_time ? grid_time : max_time;
         }
-    } else {
-        // Version parallèle
+    } else if (mode == BATCH_RUN) {
+        // Version par lots : BATCH_LANES grilles propagées ensemble en SIMD,
+        // les lots étant répartis entre les threads
+        int num_batches = (num_grids + BATCH_LANES - 1) / BATCH_LANES;
         #pragma omp parallel for reduction(+:solved,invalid_grids) reduction(min:min_time) reduction(max:max_time) schedule(dynamic, 1)
+        for(int k = 0; k < num_batches; k++) {
+            int first = k * BATCH_LANES;
+            int count = num_grids - first < BATCH_LANES ? num_grids - first : BATCH_LANES;
+            int ok[BATCH_LANES];
+            double batch_start = omp_get_wtime();
+            STAT_CLOCK(busy_start);
+            int batch_solved = batchSolve(&grids[first], ok, count, solver_backend);
+            STAT_ELAPSED(busy, busy_start);
+            solved += batch_solved;
+            invalid_grids += count - batch_solved;
+            // Les grilles d'un lot avancent ensemble : temps moyen du lot
+            double grid_time = (omp_get_wtime() - batch_start) / count;
+            min_time = grid_time < min_time ? grid_time : min_time;
+            max_time = grid_time > max_time ? grid_time : max_time;
+        }
+    } else {
+        // Version parallèle. Pré-passe : chaque grille est essayée avec un
+        // petit budget, ce qui tranche la plupart d'entre elles et donne un
+        // score aux autres
+        float *scores = malloc(num_grids * sizeof(float));
+        int *pending = malloc(num_grids * sizeof(int));
+        int *order = malloc(num_grids * sizeof(int));
+        // Formes canoniques des grilles restantes, gardées pour leur tâche
+        CanonicalForm *forms = solution_cache ? malloc(num_grids * sizeof(CanonicalForm)) : NULL;
+        if (solution_cache && !forms) {
+            printf("Erreur d'allocation mémoire (cache)\n");
+            cacheFree(solution_cache);
+            solution_cache = NULL;
+        }
+        int num_pending = 0;
+        #pragma omp parallel for reduction(+:solved,invalid_grids,cache_hits) reduction(min:min_time) reduction(max:max_time) schedule(dynamic, 16)
         for(int g = 0; g < num_grids; g++) {
             double grid_start = omp_get_wtime();
-            if (parallel_solve(grids[g])) {
-                solved++;
-            } else {
-                invalid_grids++;
+            STAT_CLOCK(busy_start);
+            int status = 0;
+            if (hasMinimumClues(&grids[g])) {
+                status = gridProbe(&grids[g], PROBE_NODES, &scores[g]);
+                if (status < 0 && forms) {
+                    int known = cache_lookup(&grids[g], &forms[g]);
+                    if (known >= 0) {
+                        status = known;
+                        cache_hits++;
+                    }
+                }
+            }
+            STAT_ELAPSED(busy, busy_start);
+            if (status < 0) {
+                int k;
+                #pragma omp atomic capture
+                k = num_pending++;
+                pending[k] = g;
+                continue;
             }
+            if (status) solved++;
+            else invalid_grids++;
             double grid_time = omp_get_wtime() - grid_start;
             min_time = grid_time < min_time ? grid_time : min_time;
             max_time = grid_time > max_time ? grid_time : max_time;
         }
+        printf("Pré-passe : %d grilles tranchées, %d ordonnées par difficulté\n",
+               num_grids - num_pending, num_pending);
+
+        // Les autres, de la plus difficile à la plus facile : une tâche par
+        // grille, les grilles difficiles ajoutant leurs sous-tâches au même
+        // ensemble de threads
+        difficultySort(scores, pending, num_pending, order);
+        #pragma omp parallel
+        #pragma omp single
+        for(int k = 0; k < num_pending; k++) {
+            int g = order[k];
+            #pragma omp task firstprivate(g) shared(solved, invalid_grids, cache_hits, min_time, max_time)
+            {
+                double grid_start = omp_get_wtime();
+                // Une grille équivalente a pu être résolue depuis la pré-passe
+                int status = forms ? cache_find(&grids[g], &forms[g]) : -1;
+                if (status < 0) {
+                    status = task_solve(&grids[g]);
+                    if (forms) cache_store(&forms[g], &grids[g], status);
+                } else {
+                    #pragma omp atomic
+                    cache_hits++;
+                }
+                if (status) {
+                    #pragma omp atomic
+                    solved++;
+                } else {
+                    #pragma omp atomic
+                    invalid_grids++;
+                }
+                double grid_time = omp_get_wtime() - grid_start;
+                #pragma omp critical(grid_times)
+                {
+                    min_time = grid_time < min_time ? grid_time : min_time;
+                    max_time = grid_time > max_time ? grid_time : max_time;
+                }
+            }
+        }
+        free(scores);
+        free(pending);
+        free(order);
+        free(forms);
     }
     
     double end = omp_get_wtime();
     double total_time = end - start;
     
-    printf("Mode : %s\n", mode == SEQUENTIAL_RUN ? "Séquentiel" : "Parallèle");
+    printf("Mode : %s\n", mode == SEQUENTIAL_RUN ? "Séquentiel" : mode == BATCH_RUN ? "Par lots (SIMD)" : "Parallèle");
     printf("Grilles résolues : %d/%d (%.1f%%)\n", solved, num_grids, (solved * 100.0) / num_grids);
     printf("Grilles invalides : %d (%.1f%%)\n", invalid_grids, (invalid_grids * 100.0) / num_grids);
     printf("Temps total : %.4f secondes\n", total_time);
@@ -200,6 +318,27 @@ double solve_grids(int (*grids)[N][N], int num_grids, int mode) {
     printf("  - Minimum : %.4f secondes\n", min_time);
     printf("  - Maximum : %.4f secondes\n", max_time);
     printf("  - Moyen   : %.4f secondes\n", total_time / num_grids);
+    if (solution_cache) {
+        printf("Cache : %d grilles trouvées sur %d, %ld formes canoniques mémorisées\n", cache_hits, num_grids,
+               cacheSize(solution_cache));
+        if (cache_file && mode == PARALLEL_RUN && !cacheSave(solution_cache, cache_file))
+            printf("Erreur d'écriture du cache dans %s\n", cache_file);
+        cacheFree(solution_cache);
+        solution_cache = NULL;
+    }
+
+    // Compteurs de chaque thread (compilation avec -DSEARCH_STATS) : calcul,
+    // vol et attente montrent un déséquilibre, les nœuds une recherche perdue
+    if (STATS_ENABLED) {
+        int threads = omp_get_max_threads();
+        SearchStats *per_thread = statsAlloc(threads);
+        if (per_thread) {
+            statsGather(per_thread, threads);
+            statsReportThreads(mode == SEQUENTIAL_RUN ? "séquentiel" : mode == BATCH_RUN ? "lots" : "parallèle",
+                               per_thread, threads, total_time);
+            free(per_thread);
+        }
+    }
     printf("----------------------------------------\n");
     
     return total_time;
@@ -207,10 +346,42 @@ double solve_grids(int (*grids)[N][N], int num_grids, int mode) {
 
 int main(int argv, char** argc) {
     if (argv < 2) {
-        printf("Usage: %s <nombre de grilles>\n", argc[0]);
+        printf("Usage: %s <nombre de grilles> [-a backtrack|dlx] [-d profondeur] [-t tâches] [-f fichier] [-c] [-C cache.sdkb]\n", argc[0]);
         return 1;
     }
     int NUM_GRIDS = atoi(argc[1]);
+    if (NUM_GRIDS <= 0) {
+        printf("Nombre de grilles invalide : %s\n", argc[1]);
+        return 1;
+    }
+    const char *grid_file = NULL;  // Grilles lues dans un fichier (Outils/generer)
+    for (int i = 2; i < argv; i++) {
+        if (strcmp(argc[i], "-a") == 0 && i + 1 < argv) {
+            if (!parseBackend(argc[++i], &solver_backend)) {
+                printf("Moteur inconnu : %s\n", argc[i]);
+                return 1;
+            }
+        } else if (strcmp(argc[i], "-d") == 0 && i + 1 < argv) {
+            frontier_depth = atoi(argc[++i]);
+        } else if (strcmp(argc[i], "-t") == 0 && i + 1 < argv) {
+            frontier_tasks = atoi(argc[++i]);
+        } else if (strcmp(argc[i], "-f") == 0 && i + 1 < argv) {
+            grid_file = argc[++i];
+        } else if (strcmp(argc[i], "-c") == 0) {
+            use_cache = 1;
+        } else if (strcmp(argc[i], "-C") == 0 && i + 1 < argv) {
+            use_cache = 1;
+            cache_file = argc[++i];
+        } else {
+            printf("Option inconnue : %s\n", argc[i]);
+            return 1;
+        }
+    }
+    if (BOX != 3 && grid_file == NULL) {
+        // La grille de base est une 9×9
+        printf("Grilles %dx%d : donner un fichier de grilles avec -f\n", N, N);
+        return 1;
+    }
     int num_threads = omp_get_max_threads();
     omp_set_num_threads(num_threads);
 
@@ -219,10 +390,11 @@ int main(int argv, char** argc) {
     } else {
         printf("Nombre de threads disponibles : %d\n", num_threads);
     }
+    printf("Moteur de résolution : %s\n", backendName(solver_backend));
     printf("----------------------------------------\n");
 
     // Grille de base à partir de laquelle nous créerons des variations
-    int baseGrid[N][N] = {
+    int baseMatrix[N][N] = {
         {3, 0, 6, 5, 0, 8, 4, 0, 0},
         {5, 2, 0, 0, 0, 0, 0, 0, 0},
         {0, 8, 7, 0, 0, 0, 0, 3, 1},
@@ -233,55 +405,78 @@ int main(int argv, char** argc) {
         {0, 0, 0, 0, 0, 0, 0, 7, 4},
         {0, 0, 5, 2, 0, 6, 3, 0, 0}
     };
+    Grid baseGrid;
+    gridFromMatrix(&baseGrid, baseMatrix);
 
-    int (*grids)[N][N] = malloc(NUM_GRIDS * sizeof(int[N][N]));
+    Grid *grids = malloc(NUM_GRIDS * sizeof(Grid));
     if (grids == NULL) {
         printf("Erreur d'allocation mémoire\n");
         return 1;
     }
 
-    // Création de variations de la grille de base avec génération thread-safe
-    #pragma omp parallel
-    {
-        unsigned int seed = time(NULL) ^ omp_get_thread_num(); // Seed unique par thread
-        
-        #pragma omp for schedule(dynamic)
-        for(int g = 0; g < NUM_GRIDS; g++) {
-            int attempts = 0;
-            do {
-                copyGrid(baseGrid, grids[g]);
-                
-                // Utilisation de notre générateur thread-safe
-                if (thread_safe_rand(&seed) % 10 == 0) {  // Probabilité de 1/10
-                    // Pour makeGridUnsolvable, on utilise aussi notre générateur thread-safe
-                    int row = thread_safe_rand(&seed) % N;
-                    int col1 = thread_safe_rand(&seed) % (N-1);
-                    int col2 = col1 + 1;
-                    grids[g][row][col1] = 1;
-                    grids[g][row][col2] = 1;
-                } else {
-                    int empty_count = 0;
-                    for(int i = 0; i < N; i++) {
-                        for(int j = 0; j < N; j++) {
-                            if (thread_safe_rand(&seed) % 100 < 65 && empty_count < 60) {
-                                grids[g][i][j] = 0;
-                                empty_count++;
+    if (grid_file) {
+        // Les NUM_GRIDS premières grilles du fichier
+        GridReader reader;
+        if (!readerOpen(&reader, grid_file)) {
+            perror(grid_file);
+            return 1;
+        }
+        NUM_GRIDS = readerChunk(&reader, grids, NUM_GRIDS);
+        if (reader.skipped > 0)
+            printf("%ld ligne(s) sans exactement %d cases ignorée(s)\n", reader.skipped, NN);
+        readerClose(&reader);
+        if (NUM_GRIDS == 0) {
+            printf("Aucune grille lue dans %s\n", grid_file);
+            free(grids);
+            return 1;
+        }
+        printf("%d grilles lues dans %s\n", NUM_GRIDS, grid_file);
+    } else {
+        // Création de variations de la grille de base avec génération thread-safe
+        #pragma omp parallel
+        {
+            unsigned int seed = time(NULL) ^ omp_get_thread_num(); // Seed unique par thread
+            
+            #pragma omp for schedule(dynamic)
+            for(int g = 0; g < NUM_GRIDS; g++) {
+                int attempts = 0;
+                do {
+                    copyGrid(&baseGrid, &grids[g]);
+                    
+                    // Utilisation de notre générateur thread-safe
+                    if (thread_safe_rand(&seed) % 10 == 0) {  // Probabilité de 1/10
+                        // Pour makeGridUnsolvable, on utilise aussi notre générateur thread-safe
+                        int row = thread_safe_rand(&seed) % N;
+                        int col1 = thread_safe_rand(&seed) % (N-1);
+                        int col2 = col1 + 1;
+                        grids[g].cells[row * N + col1] = 1;
+                        grids[g].cells[row * N + col2] = 1;
+                    } else {
+                        int empty_count = 0;
+                        for(int i = 0; i < N; i++) {
+                            for(int j = 0; j < N; j++) {
+                                if (thread_safe_rand(&seed) % 100 < 65 && empty_count < 60) {
+                                    grids[g].cells[i * N + j] = 0;
+                                    empty_count++;
+                                }
                             }
                         }
                     }
-                }
-                attempts++;
-                if (attempts > 100) {
-                    copyGrid(baseGrid, grids[g]);
-                    break;
-                }
-            } while (!hasMinimumClues(grids[g]));
+                    attempts++;
+                    if (attempts > 100) {
+                        copyGrid(&baseGrid, &grids[g]);
+                        break;
+                    }
+                } while (!hasMinimumClues(&grids[g]));
+            }
         }
     }
 
-    // Copier les grilles pour avoir deux jeux identiques
-    int (*grids_seq)[N][N] = malloc(NUM_GRIDS * sizeof(int[N][N]));
-    memcpy(grids_seq, grids, NUM_GRIDS * sizeof(int[N][N]));
+    // Copier les grilles pour avoir trois jeux identiques
+    Grid *grids_seq = malloc(NUM_GRIDS * sizeof(Grid));
+    memcpy(grids_seq, grids, NUM_GRIDS * sizeof(Grid));
+    Grid *grids_batch = malloc(NUM_GRIDS * sizeof(Grid));
+    memcpy(grids_batch, grids, NUM_GRIDS * sizeof(Grid));
 
     // Mesure séquentielle
     printf("Exécution séquentielle...\n");
@@ -291,6 +486,10 @@ int main(int argv, char** argc) {
     printf("Exécution parallèle...\n");
     double time_par = solve_grids(grids, NUM_GRIDS, PARALLEL_RUN);
 
+    // Mesure par lots
+    printf("Exécution par lots de %d grilles...\n", BATCH_LANES);
+    double time_batch = solve_grids(grids_batch, NUM_GRIDS, BATCH_RUN);
+
     // Calcul et affichage du speedup
     double speedup = time_seq / time_par;
     printf("Speedup: %.2fx\n", speedup);
@@ -302,12 +501,14 @@ int main(int argv, char** argc) {
     printf("Nombre de threads utilisés : %d\n", num_threads);
     printf("Temps séquentiel total    : %.4f secondes\n", time_seq);
     printf("Temps parallèle total     : %.4f secondes\n", time_par);
+    printf("Temps par lots total      : %.4f secondes\n", time_batch);
     printf("Speedup                   : %.2fx\n", speedup);
     printf("Efficacité               : %.2f%%\n", (speedup / num_threads) * 100);
     printf("Gain en performance      : %.1f%%\n", ((time_seq - time_par) / time_seq) * 100);
     printf("=============================\n");
 
+    free(grids_batch);
     free(grids_seq);
     free(grids);
     return 0;
-}
\ No newline at end of file
+}
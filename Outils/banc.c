@@ -0,0 +1,633 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <mpi.h>
+#include <omp.h>
+#include "../Solveur/solveur.h"
+#include "../Solveur/frontiere.h"
+#include "../Solveur/vol_travail.h"
+#include "../Solveur/taches.h"
+#include "../Solveur/lot_simd.h"
+#include "../Solveur/difficulte.h"
+#include "../Solveur/lecture.h"
+#include "../Solveur/conteneur.h"
+#include "../Solveur/generateur.h"
+#include "../Solveur/compteur_mpi.h"
+#include "../Solveur/recherche_mpi.h"
+
+// Banc d'essai commun à toutes les variantes de résolution.
+//
+// Chaque mesure résout tout le corpus (copie neuve à chaque répétition),
+// après des exécutions d'échauffement non comptées. La durée de chaque
+// grille est mesurée autour de sa seule résolution ; le débit est calculé
+// sur la durée médiane des répétitions. Avec plusieurs processus MPI, les
+// grilles sont distribuées par paquets au compteur partagé et les durées
+// rassemblées sur le processus 0.
+
+#ifndef REPO_ROOT
+#define REPO_ROOT ".."            // Racine du dépôt vue depuis Outils/
+#endif
+#define BENCH_CHUNK 256           // Grilles prises à la fois au compteur partagé
+#define MAX_THREAD_COUNTS 32
+#define PATH_SIZE 4096
+
+// Corpus nommés du dépôt
+typedef struct {
+    const char *name;
+    const char *path;
+} NamedCorpus;
+
+static const NamedCorpus named_corpora[] = {
+    {"sudoku_txt", REPO_ROOT "/OpenMP+MPI/Sudoku_txt"},
+    {"sudoku_grids", REPO_ROOT "/MPI/sudoku_grids.txt"},
+};
+
+typedef struct {
+    Grid *grids;
+    long count, capacity;
+} Corpus;
+
+// Une variante résout count grilles en place, remplit la durée de chacune et
+// renvoie le nombre de grilles résolues
+typedef long (*VariantFn)(Grid *grids, long count, double *latency);
+
+typedef struct {
+    const char *name;
+    VariantFn run;
+    int threaded;             // Sensible au nombre de threads
+    int collective;           // Tous les processus résolvent ensemble chaque grille
+} Variant;
+
+typedef struct {
+    const char *variant;
+    int ranks, threads;
+    long grids, solved;
+    double wallMedian, wallMin, throughput;
+    double latMedian, latP95, latP99, latMax;
+    double speedup, efficiency;
+} BenchResult;
+
+SolverBackend bench_backend = BACKEND_BACKTRACK;
+
+int corpusAdd(Corpus *c, const Grid *grid) {
+    if (c->count == c->capacity) {
+        long capacity = c->capacity ? 2 * c->capacity : 1024;
+        Grid *grids = realloc(c->grids, capacity * sizeof(Grid));
+        if (!grids) return 0;
+        c->grids = grids;
+        c->capacity = capacity;
+    }
+    c->grids[c->count++] = *grid;
+    return 1;
+}
+
+// Fichier texte (lu en flux) ou conteneur .sdkb
+int corpusLoadFile(Corpus *c, const char *path) {
+    GridFile container;
+    Grid grid;
+    if (gridFileOpen(&container, path)) {
+        int ok = 1;
+        for (long i = 0; i < container.count && ok; i++) {
+            gridFileGet(&container, i, &grid);
+            ok = corpusAdd(c, &grid);
+        }
+        gridFileClose(&container);
+        return ok;
+    }
+    GridReader reader;
+    if (!readerOpen(&reader, path)) {
+        perror(path);
+        return 0;
+    }
+    int ok = 1;
+    while (ok && readerNext(&reader, &grid) == 1) ok = corpusAdd(c, &grid);
+    readerClose(&reader);
+    return ok;
+}
+
+int isTextFile(const struct dirent *entry) {
+    return strstr(entry->d_name, ".txt") != NULL;
+}
+
+// Dossier de fichiers .txt, pris dans l'ordre alphabétique
+int corpusLoadDirectory(Corpus *c, const char *dir_path) {
+    struct dirent **entries;
+    int n = scandir(dir_path, &entries, isTextFile, alphasort);
+    if (n < 0) {
+        perror(dir_path);
+        return 0;
+    }
+    int ok = 1;
+    for (int i = 0; i < n; i++) {
+        char path[PATH_SIZE];
+        snprintf(path, sizeof(path), "%s/%s", dir_path, entries[i]->d_name);
+        if (ok) ok = corpusLoadFile(c, path);
+        free(entries[i]);
+    }
+    free(entries);
+    return ok;
+}
+
+// Corpus généré "gen:nombre:graine[:indices]" (Solveur/generateur.h)
+int corpusGenerate(Corpus *c, const char *spec) {
+    long count = 0;
+    unsigned long long seed = 0;
+    int clues = 0;
+    if (sscanf(spec, "gen:%ld:%llu:%d", &count, &seed, &clues) < 2 || count <= 0) {
+        printf("Corpus généré invalide : %s (gen:nombre:graine[:indices])\n", spec);
+        return 0;
+    }
+    c->grids = malloc(count * sizeof(Grid));
+    if (!c->grids) return 0;
+    c->count = c->capacity = count;
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (long i = 0; i < count; i++) {
+        Grid solution;
+        generateGrid(seed, (uint64_t)i, clues, GEN_ANY, &c->grids[i], &solution);
+    }
+    return 1;
+}
+
+int corpusLoad(Corpus *c, const char *spec) {
+    memset(c, 0, sizeof(*c));
+    if (strncmp(spec, "gen:", 4) == 0) return corpusGenerate(c, spec);
+    const char *path = spec;
+    for (size_t i = 0; i < sizeof(named_corpora) / sizeof(named_corpora[0]); i++)
+        if (strcmp(spec, named_corpora[i].name) == 0) path = named_corpora[i].path;
+    struct stat st;
+    if (stat(path, &st) == 0 && S_ISDIR(st.st_mode)) return corpusLoadDirectory(c, path);
+    return corpusLoadFile(c, path);
+}
+
+// Variantes
+
+long runSequential(Grid *grids, long count, double *latency) {
+    long solved = 0;
+    for (long i = 0; i < count; i++) {
+        double start = omp_get_wtime();
+        solved += solveGridWith(&grids[i], bench_backend);
+        latency[i] = omp_get_wtime() - start;
+    }
+    return solved;
+}
+
+// Une grille par thread
+long runGrids(Grid *grids, long count, double *latency) {
+    long solved = 0;
+    #pragma omp parallel for schedule(dynamic, 16) reduction(+:solved)
+    for (long i = 0; i < count; i++) {
+        double start = omp_get_wtime();
+        solved += solveGridWith(&grids[i], bench_backend);
+        latency[i] = omp_get_wtime() - start;
+    }
+    return solved;
+}
+
+long runDlx(Grid *grids, long count, double *latency) {
+    SolverBackend backend = bench_backend;
+    bench_backend = BACKEND_DLX;
+    long solved = runGrids(grids, count, latency);
+    bench_backend = backend;
+    return solved;
+}
+
+int taskSolveGrid(Grid *grid) {
+    Board board, solution;
+    if (!boardLoad(&board, grid) || !boardPropagate(&board)) return 0;
+    if (!taskSolveBoard(&board, bench_backend, FRONTIER_MAX_DEPTH, 0, &solution)) return 0;
+    boardStore(&solution, grid);
+    return 1;
+}
+
+// Une tâche OpenMP par grille, les grilles difficiles découpées en sous-tâches
+long runTasks(Grid *grids, long count, double *latency) {
+    long solved = 0;
+    #pragma omp parallel
+    #pragma omp single
+    for (long i = 0; i < count; i++) {
+        #pragma omp task firstprivate(i) shared(solved)
+        {
+            double start = omp_get_wtime();
+            int ok = taskSolveGrid(&grids[i]);
+            latency[i] = omp_get_wtime() - start;
+            #pragma omp atomic
+            solved += ok;
+        }
+    }
+    return solved;
+}
+
+// Lots SIMD : chaque grille d'un lot reçoit la durée moyenne du lot
+long runBatches(Grid *grids, long count, double *latency) {
+    long solved = 0;
+    long numBatches = (count + BATCH_LANES - 1) / BATCH_LANES;
+    #pragma omp parallel for schedule(dynamic, 1) reduction(+:solved)
+    for (long k = 0; k < numBatches; k++) {
+        long first = k * BATCH_LANES;
+        int n = count - first < BATCH_LANES ? (int)(count - first) : BATCH_LANES;
+        int ok[BATCH_LANES];
+        double start = omp_get_wtime();
+        solved += batchSolve(&grids[first], ok, n, bench_backend);
+        double each = (omp_get_wtime() - start) / n;
+        for (int i = 0; i < n; i++) latency[first + i] = each;
+    }
+    return solved;
+}
+
+// Pré-passe bornée, puis tâches des grilles restantes, les plus difficiles
+// d'abord (durée d'une grille restante : essai compris)
+long runOrdered(Grid *grids, long count, double *latency) {
+    float *scores = malloc(count * sizeof(float));
+    int *pending = malloc(count * sizeof(int));
+    int *order = malloc(count * sizeof(int));
+    if (!scores || !pending || !order) {
+        free(scores);
+        free(pending);
+        free(order);
+        return runTasks(grids, count, latency);
+    }
+    long solved = 0;
+    int numPending = 0;
+    #pragma omp parallel for schedule(dynamic, 16) reduction(+:solved)
+    for (long i = 0; i < count; i++) {
+        double start = omp_get_wtime();
+        int status = gridProbe(&grids[i], PROBE_NODES, &scores[i]);
+        latency[i] = omp_get_wtime() - start;
+        if (status >= 0) {
+            solved += status;
+            continue;
+        }
+        int k;
+        #pragma omp atomic capture
+        k = numPending++;
+        pending[k] = (int)i;
+    }
+    difficultySort(scores, pending, numPending, order);
+    #pragma omp parallel
+    #pragma omp single
+    for (int k = 0; k < numPending; k++) {
+        int i = order[k];
+        #pragma omp task firstprivate(i) shared(solved)
+        {
+            double start = omp_get_wtime();
+            int ok = taskSolveGrid(&grids[i]);
+            latency[i] += omp_get_wtime() - start;
+            #pragma omp atomic
+            solved += ok;
+        }
+    }
+    free(scores);
+    free(pending);
+    free(order);
+    return solved;
+}
+
+// Une grille à la fois, découpée entre tous les threads (vol de travail)
+long runStealing(Grid *grids, long count, double *latency) {
+    long solved = 0;
+    int threads = omp_get_max_threads();
+    for (long i = 0; i < count; i++) {
+        double start = omp_get_wtime();
+        Board board, solution;
+        int found = 0;
+        if (boardLoad(&board, &grids[i]) && boardPropagate(&board)) {
+            Frontier frontier;
+            frontierInit(&frontier);
+            if (!frontierExpand(&frontier, &board, FRONTIER_MAX_DEPTH, FRONTIER_TASKS_PER_THREAD * threads)) {
+                found = -1;
+            } else if (frontier.solved) {
+                solution = frontier.solution;
+                found = 1;
+            } else if (frontierCount(&frontier) > 0) {
+                found = stealSolve(&frontier, bench_backend, threads, &solution);
+            }
+            frontierFree(&frontier);
+            if (found < 0) {
+                // Mémoire insuffisante : résolution sans découpage
+                solution = board;
+                found = boardSolveWith(&solution, bench_backend, NULL);
+            }
+        }
+        if (found) boardStore(&solution, &grids[i]);
+        latency[i] = omp_get_wtime() - start;
+        solved += found;
+    }
+    return solved;
+}
+
+// Une grille à la fois, découpée entre tous les processus (distSolve, comme
+// MPI/sudoku-mpi ; collectif). La recherche distribuée est celle du
+// backtracking, quel que soit -a.
+long runDistributed(Grid *grids, long count, double *latency) {
+    long solved = 0;
+    for (long i = 0; i < count; i++) {
+        double start = MPI_Wtime();
+        Board board, solution;
+        int found = 0;
+        if (boardLoad(&board, &grids[i]) && boardPropagate(&board)) {
+            found = distSolve(&board, MPI_COMM_WORLD, FRONTIER_MAX_DEPTH, &solution);
+            if (found < 0) {
+                // Mémoire insuffisante (sur tous les processus) : sans découpage
+                solution = board;
+                found = boardSolveWith(&solution, bench_backend, NULL);
+            }
+        }
+        if (found) boardStore(&solution, &grids[i]);
+        latency[i] = MPI_Wtime() - start;
+        solved += found;
+    }
+    return solved;
+}
+
+static const Variant variants[] = {
+    {"sequentiel", runSequential, 0, 0},
+    {"grilles", runGrids, 1, 0},
+    {"dlx", runDlx, 1, 0},
+    {"taches", runTasks, 1, 0},
+    {"lots", runBatches, 1, 0},
+    {"ordonne", runOrdered, 1, 0},
+    {"vol", runStealing, 1, 0},
+    {"distribue", runDistributed, 0, 1},
+};
+#define NUM_VARIANTS ((int)(sizeof(variants) / sizeof(variants[0])))
+
+// Mesures
+
+int compareDouble(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Percentile (rang le plus proche) d'un tableau trié
+double percentile(const double *sorted, long count, double p) {
+    if (count == 0) return 0.0;
+    long rank = (long)(p / 100.0 * count + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > count) rank = count;
+    return sorted[rank - 1];
+}
+
+// Une exécution sur tout le corpus (collectif) : les processus prennent des
+// paquets au compteur partagé, ou résolvent ensemble chaque grille pour une
+// variante collective. Sur le processus 0, latency reçoit la durée de chaque
+// grille. Renvoie la durée de l'exécution (la plus longue des processus).
+double runOnce(const Variant *v, const Corpus *corpus, Grid *work, double *latency, long *solved) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    memcpy(work, corpus->grids, corpus->count * sizeof(Grid));
+    memset(latency, 0, corpus->count * sizeof(double));
+    WorkCounter counter;
+    workCounterCreate(&counter, MPI_COMM_WORLD);
+    MPI_Barrier(MPI_COMM_WORLD);
+    double start = MPI_Wtime();
+    long localSolved = 0;
+    if (v->collective) {
+        localSolved = v->run(work, corpus->count, latency);
+        if (rank != 0) localSolved = 0;  // Mêmes grilles sur tous les processus
+    } else {
+        for (;;) {
+            long first = workCounterNext(&counter, BENCH_CHUNK);
+            if (first >= corpus->count) break;
+            long n = corpus->count - first < BENCH_CHUNK ? corpus->count - first : BENCH_CHUNK;
+            localSolved += v->run(&work[first], n, &latency[first]);
+        }
+    }
+    double elapsed = MPI_Wtime() - start, wall;
+    workCounterFree(&counter);
+
+    // Chaque grille n'a été résolue que par un processus (ou par tous)
+    MPI_Reduce(rank == 0 ? MPI_IN_PLACE : latency, latency, (int)corpus->count, MPI_DOUBLE, MPI_MAX, 0,
+               MPI_COMM_WORLD);
+    MPI_Reduce(&localSolved, solved, 1, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+    MPI_Reduce(&elapsed, &wall, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    return wall;
+}
+
+// Échauffement puis répétitions ; résultat rempli sur le processus 0
+void benchmark(const Variant *v, const Corpus *corpus, int warmup, int repeats, BenchResult *r) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    Grid *work = malloc(corpus->count * sizeof(Grid));
+    double *latency = malloc(corpus->count * sizeof(double));
+    double *samples = rank == 0 ? malloc(repeats * corpus->count * sizeof(double)) : NULL;
+    double *walls = malloc(repeats * sizeof(double));
+    if (!work || !latency || !walls || (rank == 0 && !samples)) {
+        printf("Erreur d'allocation mémoire\n");
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    long solved = 0;
+    for (int i = 0; i < warmup; i++) runOnce(v, corpus, work, latency, &solved);
+    for (int i = 0; i < repeats; i++) {
+        walls[i] = runOnce(v, corpus, work, latency, &solved);
+        if (rank == 0) memcpy(samples + i * corpus->count, latency, corpus->count * sizeof(double));
+    }
+
+    if (rank == 0) {
+        long n = repeats * corpus->count;
+        qsort(walls, repeats, sizeof(double), compareDouble);
+        qsort(samples, n, sizeof(double), compareDouble);
+        r->variant = v->name;
+        r->grids = corpus->count;
+        r->solved = solved;
+        r->wallMedian = percentile(walls, repeats, 50);
+        r->wallMin = walls[0];
+        r->throughput = r->wallMedian > 0 ? corpus->count / r->wallMedian : 0.0;
+        r->latMedian = percentile(samples, n, 50);
+        r->latP95 = percentile(samples, n, 95);
+        r->latP99 = percentile(samples, n, 99);
+        r->latMax = samples[n - 1];
+    }
+    free(work);
+    free(latency);
+    free(samples);
+    free(walls);
+}
+
+// Sorties
+
+void writeCsv(FILE *out, const char *corpus, const char *scaling, const BenchResult *r) {
+    fprintf(out, "%s,%s,%s,%d,%d,%d,%ld,%ld,%.6f,%.6f,%.1f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n", corpus, r->variant,
+            scaling, BOX * BOX, r->ranks, r->threads, r->grids, r->solved, r->wallMedian, r->wallMin,
+            r->throughput, r->latMedian * 1e6, r->latP95 * 1e6, r->latP99 * 1e6, r->latMax * 1e6, r->speedup,
+            r->efficiency);
+}
+
+void writeJson(FILE *out, const char *corpus, const char *scaling, const BenchResult *r) {
+    fprintf(out,
+            "{\"corpus\":\"%s\",\"variante\":\"%s\",\"echelle\":\"%s\",\"taille\":%d,\"processus\":%d,"
+            "\"threads\":%d,\"grilles\":%ld,\"resolues\":%ld,\"duree_mediane_s\":%.6f,\"duree_min_s\":%.6f,"
+            "\"debit_grilles_s\":%.1f,\"latence_mediane_us\":%.3f,\"latence_p95_us\":%.3f,"
+            "\"latence_p99_us\":%.3f,\"latence_max_us\":%.3f,\"speedup\":%.3f,\"efficacite\":%.3f}\n",
+            corpus, r->variant, scaling, BOX * BOX, r->ranks, r->threads, r->grids, r->solved, r->wallMedian,
+            r->wallMin, r->throughput, r->latMedian * 1e6, r->latP95 * 1e6, r->latP99 * 1e6, r->latMax * 1e6,
+            r->speedup, r->efficiency);
+}
+
+// Ajoute une ligne au fichier de résultats (en-tête CSV si le fichier est neuf)
+void appendResult(const char *path, const char *corpus, const char *scaling, const BenchResult *r) {
+    size_t len = strlen(path);
+    int json = len >= 5 && strcmp(path + len - 5, ".json") == 0;
+    struct stat st;
+    int fresh = stat(path, &st) != 0 || st.st_size == 0;
+    FILE *out = fopen(path, "a");
+    if (!out) {
+        perror(path);
+        return;
+    }
+    if (json) {
+        writeJson(out, corpus, scaling, r);
+    } else {
+        if (fresh)
+            fprintf(out, "corpus,variante,echelle,taille,processus,threads,grilles,resolues,duree_mediane_s,"
+                         "duree_min_s,debit_grilles_s,latence_mediane_us,latence_p95_us,latence_p99_us,"
+                         "latence_max_us,speedup,efficacite\n");
+        writeCsv(out, corpus, scaling, r);
+    }
+    fclose(out);
+}
+
+// Liste "1,2,4" ; renvoie le nombre de valeurs
+int parseList(const char *text, int *values, int max) {
+    int count = 0;
+    char *copy = strdup(text), *save = NULL;
+    for (char *item = strtok_r(copy, ",", &save); item && count < max; item = strtok_r(NULL, ",", &save)) {
+        int v = atoi(item);
+        if (v > 0) values[count++] = v;
+    }
+    free(copy);
+    return count;
+}
+
+const Variant *findVariant(const char *name) {
+    for (int i = 0; i < NUM_VARIANTS; i++)
+        if (strcmp(variants[i].name, name) == 0) return &variants[i];
+    return NULL;
+}
+
+int main(int argc, char *argv[]) {
+    int rank, size;
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    if (argc < 2) {
+        if (rank == 0) {
+            printf("Usage: %s <corpus> [-v variante,...] [-t threads,...] [-r répétitions] [-w échauffement]\n"
+                   "          [-W] [-a backtrack|dlx] [-o résultats.csv|résultats.json]\n",
+                   argv[0]);
+            printf("Corpus : sudoku_txt, sudoku_grids, gen:nombre:graine[:indices], fichier ou dossier\n");
+            printf("Variantes :");
+            for (int i = 0; i < NUM_VARIANTS; i++) printf(" %s", variants[i].name);
+            printf("\n");
+        }
+        MPI_Finalize();
+        return 1;
+    }
+    const char *variant_list = "sequentiel,grilles,taches,lots,ordonne";
+    int thread_counts[MAX_THREAD_COUNTS] = {omp_get_max_threads()};
+    int num_thread_counts = 1;
+    int repeats = 5, warmup = 1, weak = 0;
+    const char *output = NULL;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0 && i + 1 < argc) {
+            variant_list = argv[++i];
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            num_thread_counts = parseList(argv[++i], thread_counts, MAX_THREAD_COUNTS);
+        } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            repeats = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+            warmup = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-W") == 0) {
+            weak = 1;
+        } else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc && parseBackend(argv[i + 1], &bench_backend)) {
+            i++;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            if (rank == 0) printf("Option inconnue : %s\n", argv[i]);
+            MPI_Finalize();
+            return 1;
+        }
+    }
+    if (repeats < 1 || warmup < 0 || num_thread_counts == 0) {
+        if (rank == 0) printf("Répétitions, échauffement ou threads invalides\n");
+        MPI_Finalize();
+        return 1;
+    }
+
+    // Le processus 0 charge le corpus et le diffuse
+    Corpus base;
+    long count = 0;
+    if (rank == 0) {
+        if (!corpusLoad(&base, argv[1]) || base.count == 0) {
+            printf("Corpus vide ou illisible : %s\n", argv[1]);
+            MPI_Abort(MPI_COMM_WORLD, 1);
+        }
+        count = base.count;
+    }
+    MPI_Bcast(&count, 1, MPI_LONG, 0, MPI_COMM_WORLD);
+    if (rank != 0) {
+        base.count = base.capacity = count;
+        base.grids = malloc(count * sizeof(Grid));
+    }
+    MPI_Bcast(base.grids, (int)(count * sizeof(Grid)), MPI_BYTE, 0, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        printf("Corpus %s : %ld grilles %dx%d, %d processus, %d répétitions (+%d d'échauffement)%s\n", argv[1],
+               count, N, N, size, repeats, warmup, weak ? ", échelle faible" : "");
+        printf("%-11s %4s %4s %9s %9s %12s %10s %10s %10s %8s\n", "variante", "proc", "thr", "grilles",
+               "médiane s", "grilles/s", "lat p50 µs", "lat p95 µs", "lat p99 µs", "speedup");
+    }
+
+    char *list = strdup(variant_list), *save = NULL;
+    for (char *name = strtok_r(list, ",", &save); name; name = strtok_r(NULL, ",", &save)) {
+        const Variant *v = findVariant(name);
+        if (!v) {
+            if (rank == 0) printf("Variante inconnue : %s\n", name);
+            continue;
+        }
+        double baseThroughput = 0.0;
+        int baseWorkers = 0;
+        for (int t = 0; t < (v->threaded ? num_thread_counts : 1); t++) {
+            int threads = v->threaded ? thread_counts[t] : 1;
+            omp_set_num_threads(threads);
+
+            // Échelle faible : corpus répété proportionnellement aux unités
+            // de calcul (threads × processus)
+            Corpus corpus = base;
+            if (weak) {
+                corpus.count = base.count * threads * size;
+                corpus.grids = malloc(corpus.count * sizeof(Grid));
+                for (long i = 0; i < corpus.count; i++) corpus.grids[i] = base.grids[i % base.count];
+            }
+
+            BenchResult r;
+            memset(&r, 0, sizeof(r));
+            benchmark(v, &corpus, warmup, repeats, &r);
+            if (weak) free(corpus.grids);
+            if (rank != 0) continue;
+
+            r.ranks = size;
+            r.threads = threads;
+            if (t == 0) {
+                baseThroughput = r.throughput;
+                baseWorkers = threads * size;
+            }
+            r.speedup = baseThroughput > 0 ? r.throughput / baseThroughput : 0.0;
+            r.efficiency = r.speedup * baseWorkers / (threads * size);
+            printf("%-11s %4d %4d %9ld %9.4f %12.0f %10.1f %10.1f %10.1f %8.2f\n", r.variant, r.ranks,
+                   r.threads, r.grids, r.wallMedian, r.throughput, r.latMedian * 1e6, r.latP95 * 1e6,
+                   r.latP99 * 1e6, r.speedup);
+            if (r.solved != r.grids)
+                printf("            (%ld grilles sur %ld résolues)\n", r.solved, r.grids);
+            if (output) appendResult(output, argv[1], weak ? "faible" : "forte", &r);
+        }
+    }
+    free(list);
+    free(base.grids);
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "../Solveur/solveur.h"
+#include "../Solveur/lecture.h"
+#include "../Solveur/conteneur.h"
+
+#define PATH_SIZE 4096
+
+// Conversion des formats texte (sudoku_grids.txt, grilles de 81 caractères
+// par ligne, dossier Sudoku_txt) vers le conteneur binaire .sdkb.
+
+int with_solutions = 0;  // Option -s : résoudre et stocker les solutions
+
+// Ajoute un paquet de grilles ; avec -s, les grilles sont résolues en parallèle
+int appendChunk(GridFileWriter *writer, const Grid *grids, int count) {
+    Grid *solutions = NULL;
+    int *solved = NULL;
+    if (with_solutions) {
+        solutions = malloc(count * sizeof(Grid));
+        solved = malloc(count * sizeof(int));
+        if (!solutions || !solved) {
+            free(solutions);
+            free(solved);
+            return 0;
+        }
+        #pragma omp parallel for schedule(dynamic, 16)
+        for (int i = 0; i < count; i++) {
+            solutions[i] = grids[i];
+            solved[i] = solveGrid(&solutions[i]);
+        }
+    }
+
+    int ok = 1;
+    for (int i = 0; i < count && ok; i++)
+        ok = gridFileAppend(writer, &grids[i], with_solutions && solved[i] ? &solutions[i] : NULL);
+    free(solutions);
+    free(solved);
+    return ok;
+}
+
+// Convertit toutes les grilles d'un fichier texte (lecture en flux)
+int convertFile(GridFileWriter *writer, const char *path) {
+    GridReader reader;
+    if (!readerOpen(&reader, path)) {
+        perror(path);
+        return 0;
+    }
+    Grid *chunk = malloc(READ_CHUNK * sizeof(Grid));
+    int ok = chunk != NULL, count;
+    while (ok && (count = readerChunk(&reader, chunk, READ_CHUNK)) > 0)
+        ok = appendChunk(writer, chunk, count);
+    if (ok && readerNext(&reader, chunk) < 0)
+        fprintf(stderr, "%s : grille incomplète en fin de fichier ignorée\n", path);
+    if (reader.skipped > 0)
+        fprintf(stderr, "%s : %ld ligne(s) sans exactement %d cases ignorée(s)\n", path, reader.skipped, NN);
+    free(chunk);
+    readerClose(&reader);
+    return ok;
+}
+
+int isTextFile(const struct dirent *entry) {
+    return strstr(entry->d_name, ".txt") != NULL;
+}
+
+// Convertit un dossier de fichiers .txt d'une grille chacun (ordre alphabétique)
+int convertDirectory(GridFileWriter *writer, const char *dir_path) {
+    struct dirent **entries;
+    int n = scandir(dir_path, &entries, isTextFile, alphasort);
+    if (n < 0) {
+        perror(dir_path);
+        return 0;
+    }
+    int ok = 1;
+    for (int i = 0; i < n; i++) {
+        char path[PATH_SIZE];
+        snprintf(path, sizeof(path), "%s/%s", dir_path, entries[i]->d_name);
+        if (ok) ok = convertFile(writer, path);
+        free(entries[i]);
+    }
+    free(entries);
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        printf("Usage: %s <fichier|dossier> <sortie.sdkb> [-s]\n", argv[0]);
+        return 1;
+    }
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0) {
+            with_solutions = 1;
+        } else {
+            printf("Option inconnue : %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    GridFileWriter writer;
+    if (!gridFileCreate(&writer, argv[2], with_solutions)) {
+        perror(argv[2]);
+        return 1;
+    }
+    struct stat st;
+    int ok = stat(argv[1], &st) == 0 && S_ISDIR(st.st_mode)
+                 ? convertDirectory(&writer, argv[1])
+                 : convertFile(&writer, argv[1]);
+    long count = (long)writer.header.count;
+    if (!gridFileFinish(&writer) || !ok) {
+        printf("Erreur lors de la conversion\n");
+        return 1;
+    }
+    printf("%ld grilles écrites dans %s%s\n", count, argv[2], with_solutions ? " (avec solutions)" : "");
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <omp.h>
+#include "../Solveur/generateur.h"
+#include "../Solveur/conteneur.h"
+
+#define GEN_CHUNK 4096            // Grilles générées en parallèle avant écriture
+
+// Génération de grilles à solution unique, écrites au format texte (une
+// grille de NN caractères par ligne) ou dans un conteneur .sdkb avec leurs
+// solutions.
+
+int target_clues = 0;             // Option -c (0 : minimum atteignable)
+GenLevel level = GEN_ANY;         // Option -n
+uint64_t seed;                    // Option -s
+
+int hasSuffix(const char *name, const char *suffix) {
+    size_t n = strlen(name), s = strlen(suffix);
+    return n >= s && strcmp(name + n - s, suffix) == 0;
+}
+
+void writeLine(FILE *out, const Grid *grid) {
+    char line[NN + 1];
+    for (int idx = 0; idx < NN; idx++)
+        line[idx] = cellChar(grid->cells[idx]);
+    line[NN] = '\n';
+    fwrite(line, 1, sizeof(line), out);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        printf("Usage: %s <nombre> <sortie.txt|sortie.sdkb> [-c indices] [-n facile|difficile] [-s graine]\n",
+               argv[0]);
+        return 1;
+    }
+    long count = atol(argv[1]);
+    seed = (uint64_t)time(NULL);
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            target_clues = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            i++;
+            if (strcmp(argv[i], "facile") == 0) level = GEN_EASY;
+            else if (strcmp(argv[i], "difficile") == 0) level = GEN_HARD;
+            else {
+                printf("Niveau inconnu : %s\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else {
+            printf("Option inconnue : %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (count <= 0) {
+        printf("Nombre de grilles invalide : %s\n", argv[1]);
+        return 1;
+    }
+
+    int binary = hasSuffix(argv[2], ".sdkb");
+    GridFileWriter writer;
+    FILE *out = NULL;
+    if (binary ? !gridFileCreate(&writer, argv[2], 1) : !(out = fopen(argv[2], "w"))) {
+        perror(argv[2]);
+        return 1;
+    }
+
+    Grid *puzzles = malloc(GEN_CHUNK * sizeof(Grid));
+    Grid *solutions = malloc(GEN_CHUNK * sizeof(Grid));
+    if (!puzzles || !solutions) {
+        printf("Erreur d'allocation mémoire\n");
+        return 1;
+    }
+
+    double start = omp_get_wtime();
+    long totalClues = 0, missed = 0, easy = 0;
+    int ok = 1;
+    for (long first = 0; first < count && ok; first += GEN_CHUNK) {
+        int chunk = count - first < GEN_CHUNK ? (int)(count - first) : GEN_CHUNK;
+        #pragma omp parallel for schedule(dynamic, 16) reduction(+ : totalClues, missed, easy)
+        for (int i = 0; i < chunk; i++) {
+            int clues = generateGrid(seed, (uint64_t)(first + i), target_clues, level, &puzzles[i],
+                                     &solutions[i]);
+            totalClues += clues;
+            missed += target_clues > 0 && clues > target_clues;
+            easy += level == GEN_HARD && genSolvedBySingles(&puzzles[i]);
+        }
+        // Écriture dans l'ordre des numéros : sortie identique pour une graine
+        for (int i = 0; i < chunk && ok; i++) {
+            if (binary) ok = gridFileAppend(&writer, &puzzles[i], &solutions[i]);
+            else writeLine(out, &puzzles[i]);
+        }
+    }
+    ok &= binary ? gridFileFinish(&writer) : fclose(out) == 0;
+    double elapsed = omp_get_wtime() - start;
+    free(puzzles);
+    free(solutions);
+    if (!ok) {
+        printf("Erreur d'écriture dans %s\n", argv[2]);
+        return 1;
+    }
+
+    printf("%ld grilles écrites dans %s en %.4f secondes (graine %llu)\n", count, argv[2], elapsed,
+           (unsigned long long)seed);
+    printf("Indices par grille : %.2f en moyenne\n", (double)totalClues / count);
+    if (missed)
+        printf("%ld grilles gardent plus de %d indices (aucun retrait possible)\n", missed, target_clues);
+    if (easy)
+        printf("%ld grilles restent résolues par les singletons (niveau difficile non atteint)\n", easy);
+    return 0;
+}
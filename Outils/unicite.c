@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+#include "../Solveur/comptage.h"
+#include "../Solveur/lecture.h"
+#include "../Solveur/conteneur.h"
+
+// Vérification des grilles générées : nombre de solutions de chaque grille
+// (0, 1 ou plusieurs), compté jusqu'à une limite.
+
+int limit = COUNT_UNIQUE;     // Option -k
+int verbose = 0;              // Option -v : une ligne par grille
+long counts[3];               // Grilles sans solution, à solution unique, à plusieurs
+
+// Compte les solutions d'un paquet de grilles. Avec assez de grilles, chaque
+// thread traite des grilles entières ; sinon chaque grille est découpée entre
+// les threads.
+void countChunk(const Grid *grids, int count, long first) {
+    int *result = malloc(count * sizeof(int));
+    if (count >= omp_get_max_threads()) {
+        #pragma omp parallel for schedule(dynamic, 16)
+        for (int i = 0; i < count; i++)
+            result[i] = countGridSolutions(&grids[i], limit);
+    } else {
+        for (int i = 0; i < count; i++) {
+            Board b;
+            result[i] = boardLoad(&b, &grids[i]) ? parallelCountSolutions(&b, limit, 0, 0) : 0;
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        counts[result[i] < 2 ? result[i] : 2]++;
+        if (verbose) {
+            if (result[i] < limit) printf("Grille %ld : %d solution(s)\n", first + i + 1, result[i]);
+            else printf("Grille %ld : au moins %d solutions\n", first + i + 1, result[i]);
+        }
+    }
+    free(result);
+}
+
+// Fichier texte lu en flux
+int countFile(const char *path) {
+    GridReader reader;
+    if (!readerOpen(&reader, path)) {
+        perror(path);
+        return 0;
+    }
+    Grid *chunk = malloc(READ_CHUNK * sizeof(Grid));
+    if (!chunk) {
+        readerClose(&reader);
+        return 0;
+    }
+    long first = 0;
+    int count;
+    while ((count = readerChunk(&reader, chunk, READ_CHUNK)) > 0) {
+        countChunk(chunk, count, first);
+        first += count;
+    }
+    if (readerNext(&reader, chunk) < 0)
+        fprintf(stderr, "%s : grille incomplète en fin de fichier ignorée\n", path);
+    if (reader.skipped > 0)
+        fprintf(stderr, "%s : %ld ligne(s) sans exactement %d cases ignorée(s)\n", path, reader.skipped, NN);
+    free(chunk);
+    readerClose(&reader);
+    return 1;
+}
+
+// Conteneur .sdkb, lu en place par paquets
+int countContainer(const GridFile *file) {
+    Grid *chunk = malloc(READ_CHUNK * sizeof(Grid));
+    if (!chunk) return 0;
+    for (long first = 0; first < file->count; first += READ_CHUNK) {
+        int count = file->count - first < READ_CHUNK ? (int)(file->count - first) : READ_CHUNK;
+        for (int i = 0; i < count; i++) gridFileGet(file, first + i, &chunk[i]);
+        countChunk(chunk, count, first);
+    }
+    free(chunk);
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        printf("Usage: %s <fichier|fichier.sdkb> [-k limite] [-v]\n", argv[0]);
+        return 1;
+    }
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+            limit = atoi(argv[++i]);
+            if (limit < 2) {
+                printf("Limite invalide : %s\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-v") == 0) {
+            verbose = 1;
+        } else {
+            printf("Option inconnue : %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    double start = omp_get_wtime();
+    GridFile container;
+    int ok;
+    if (gridFileOpen(&container, argv[1])) {
+        ok = countContainer(&container);
+        gridFileClose(&container);
+    } else {
+        ok = countFile(argv[1]);
+    }
+    if (!ok) return 1;
+    double elapsed = omp_get_wtime() - start;
+
+    long total = counts[0] + counts[1] + counts[2];
+    printf("%ld grilles vérifiées en %.4f secondes\n", total, elapsed);
+    printf("  sans solution        : %ld\n", counts[0]);
+    printf("  solution unique      : %ld\n", counts[1]);
+    printf("  plusieurs solutions  : %ld\n", counts[2]);
+    return counts[0] + counts[2] > 0 ? 2 : 0;
+}
@@ -0,0 +1,334 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <omp.h>
+#include "../Solveur/solveur.h"
+#include "../Solveur/frontiere.h"
+#include "../Solveur/vol_travail.h"
+#include "../Solveur/taches.h"
+#include "../Solveur/lot_simd.h"
+#include "../Solveur/comptage.h"
+#include "../Solveur/lecture.h"
+#include "../Solveur/conteneur.h"
+#include "../Solveur/generateur.h"
+#include "../Solveur/cache_solutions.h"
+
+// Vérification rapide de tout le noyau sur un jeu de grilles (par défaut
+// MPI/sudoku_grids.txt) : comptage des solutions, solution de chaque moteur
+// et ordonnanceur, aller-retour par un conteneur .sdkb (étapes de convertir
+// puis de unicite) et invariance de la forme canonique par symétrie.
+
+#ifndef REPO_ROOT
+#define REPO_ROOT ".."            // Racine du dépôt vue depuis Outils/
+#endif
+#define CHECK_LIMIT 10            // Solutions comptées au plus par grille
+#define CHECK_SHUFFLES 4          // Symétries essayées par grille
+
+typedef struct {
+    Grid *grids;
+    long count, capacity;
+} GridSet;
+
+// Un moteur résout count grilles en place ; ok[i] vaut 1 si la grille i est résolue
+typedef void (*EngineFn)(Grid *grids, int *ok, long count);
+
+typedef struct {
+    const char *name;
+    EngineFn run;
+} Engine;
+
+int failures = 0;
+
+// Affiche le résultat d'une vérification et compte les échecs
+void report(const char *name, long errors, long total) {
+    printf("  %-34s %s (%ld/%ld)\n", name, errors ? "ÉCHEC" : "ok", total - errors, total);
+    failures += errors > 0;
+}
+
+// 1 si solution est complète, cohérente et garde les indices de puzzle
+int isSolutionOf(const Grid *solution, const Grid *puzzle) {
+    Board b;
+    if (!boardLoad(&b, solution) || b.numEmpty != 0) return 0;
+    for (int idx = 0; idx < NN; idx++)
+        if (puzzle->cells[idx] && puzzle->cells[idx] != solution->cells[idx]) return 0;
+    return 1;
+}
+
+int setAdd(GridSet *s, const Grid *grid) {
+    if (s->count == s->capacity) {
+        long capacity = s->capacity ? 2 * s->capacity : 1024;
+        Grid *grids = realloc(s->grids, capacity * sizeof(Grid));
+        if (!grids) return 0;
+        s->grids = grids;
+        s->capacity = capacity;
+    }
+    s->grids[s->count++] = *grid;
+    return 1;
+}
+
+// Fichier texte ou conteneur .sdkb (le lecteur reconnaît l'en-tête)
+int setLoad(GridSet *s, const char *path) {
+    memset(s, 0, sizeof(*s));
+    GridReader reader;
+    if (!readerOpen(&reader, path)) {
+        perror(path);
+        return 0;
+    }
+    Grid grid;
+    int ok = 1;
+    while (ok && readerNext(&reader, &grid) == 1) ok = setAdd(s, &grid);
+    readerClose(&reader);
+    return ok;
+}
+
+// Moteurs
+
+void solveBacktrack(Grid *grids, int *ok, long count) {
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (long i = 0; i < count; i++) ok[i] = solveGridWith(&grids[i], BACKEND_BACKTRACK);
+}
+
+void solveDlx(Grid *grids, int *ok, long count) {
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (long i = 0; i < count; i++) ok[i] = solveGridWith(&grids[i], BACKEND_DLX);
+}
+
+void solveBatches(Grid *grids, int *ok, long count) {
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (long first = 0; first < count; first += BATCH_LANES) {
+        int n = count - first < BATCH_LANES ? (int)(count - first) : BATCH_LANES;
+        batchSolve(&grids[first], &ok[first], n, BACKEND_BACKTRACK);
+    }
+}
+
+// Une grille à la fois, découpée entre tous les threads (vol_travail.h)
+void solveStealing(Grid *grids, int *ok, long count) {
+    int threads = omp_get_max_threads();
+    for (long i = 0; i < count; i++) {
+        Board board, solution;
+        int found = 0;
+        if (boardLoad(&board, &grids[i]) && boardPropagate(&board)) {
+            Frontier frontier;
+            frontierInit(&frontier);
+            if (!frontierExpand(&frontier, &board, FRONTIER_MAX_DEPTH, FRONTIER_TASKS_PER_THREAD * threads)) {
+                found = -1;
+            } else if (frontier.solved) {
+                solution = frontier.solution;
+                found = 1;
+            } else if (frontierCount(&frontier) > 0) {
+                found = stealSolve(&frontier, BACKEND_BACKTRACK, threads, &solution);
+            }
+            frontierFree(&frontier);
+            if (found < 0) {
+                solution = board;
+                found = boardSolveWith(&solution, BACKEND_BACKTRACK, NULL);
+            }
+        }
+        if (found) boardStore(&solution, &grids[i]);
+        ok[i] = found;
+    }
+}
+
+// Une tâche OpenMP par grille, les grilles difficiles découpées (taches.h)
+void solveTasks(Grid *grids, int *ok, long count) {
+    #pragma omp parallel
+    #pragma omp single
+    for (long i = 0; i < count; i++) {
+        #pragma omp task firstprivate(i)
+        {
+            Board board, solution;
+            ok[i] = boardLoad(&board, &grids[i]) && boardPropagate(&board) &&
+                    taskSolveBoard(&board, BACKEND_BACKTRACK, FRONTIER_MAX_DEPTH, 0, &solution);
+            if (ok[i]) boardStore(&solution, &grids[i]);
+        }
+    }
+}
+
+static const Engine engines[] = {
+    {"backtrack", solveBacktrack},
+    {"dlx", solveDlx},
+    {"lots", solveBatches},
+    {"vol", solveStealing},
+    {"taches", solveTasks},
+};
+#define NUM_ENGINES ((int)(sizeof(engines) / sizeof(engines[0])))
+
+// Vérifications
+
+// Comptage séquentiel et parallèle, plus deux cas connus (grille vide, indices
+// contradictoires). Remplit counts.
+void checkCounting(const GridSet *s, int *counts) {
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (long i = 0; i < s->count; i++) counts[i] = countGridSolutions(&s->grids[i], CHECK_LIMIT);
+
+    long errors = 0;
+    for (long i = 0; i < s->count; i++) {
+        Board b;
+        int parallel = boardLoad(&b, &s->grids[i]) ? parallelCountSolutions(&b, CHECK_LIMIT, 0, 0) : 0;
+        errors += parallel != counts[i];
+    }
+    report("comptage parallèle", errors, s->count);
+
+    Grid empty, contradiction;
+    memset(&empty, 0, sizeof(empty));
+    contradiction = empty;
+    contradiction.cells[0] = contradiction.cells[1] = 1;
+    errors = (countGridSolutions(&empty, CHECK_LIMIT) != CHECK_LIMIT) +
+             (countGridSolutions(&contradiction, CHECK_LIMIT) != 0);
+    report("comptage (cas connus)", errors, 2);
+
+    long none = 0, unique = 0;
+    for (long i = 0; i < s->count; i++) {
+        none += counts[i] == 0;
+        unique += counts[i] == 1;
+    }
+    printf("  (%ld sans solution, %ld à solution unique, %ld à plusieurs)\n", none, unique,
+           s->count - none - unique);
+}
+
+// Chaque moteur : résolue si et seulement si une solution existe, solution
+// complète qui garde les indices, et la même que la référence quand elle est
+// unique. La référence (backtrack) est écrite dans solutions.
+int checkEngines(const GridSet *s, const int *counts, Grid *solutions) {
+    Grid *work = malloc(s->count * sizeof(Grid));
+    int *ok = malloc(s->count * sizeof(int));
+    if (!work || !ok) {
+        free(work);
+        free(ok);
+        return 0;
+    }
+    for (int e = 0; e < NUM_ENGINES; e++) {
+        memcpy(work, s->grids, s->count * sizeof(Grid));
+        engines[e].run(work, ok, s->count);
+        long errors = 0;
+        for (long i = 0; i < s->count; i++) {
+            int valid = ok[i] ? isSolutionOf(&work[i], &s->grids[i]) : counts[i] == 0;
+            if (ok[i] && counts[i] == 1 && e > 0)
+                valid &= memcmp(&work[i], &solutions[i], sizeof(Grid)) == 0;
+            errors += !valid;
+        }
+        if (e == 0) memcpy(solutions, work, s->count * sizeof(Grid));
+        char name[64];
+        snprintf(name, sizeof(name), "moteur %s", engines[e].name);
+        report(name, errors, s->count);
+    }
+    free(work);
+    free(ok);
+    return 1;
+}
+
+// Aller-retour par un conteneur temporaire, comme convertir -s puis unicite :
+// grilles et solutions relues à l'identique, par gridFileOpen et par le
+// lecteur en flux, et même nombre de solutions
+int checkContainer(const GridSet *s, const int *counts, const Grid *solutions) {
+    char path[] = "/tmp/verifierXXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        perror("mkstemp");
+        return 0;
+    }
+    close(fd);
+
+    GridFileWriter writer;
+    int ok = gridFileCreate(&writer, path, 1);
+    for (long i = 0; ok && i < s->count; i++)
+        ok = gridFileAppend(&writer, &s->grids[i], counts[i] ? &solutions[i] : NULL);
+    ok = ok && gridFileFinish(&writer);
+
+    GridFile file;
+    if (!ok || !gridFileOpen(&file, path)) {
+        printf("  Écriture ou relecture de %s impossible\n", path);
+        unlink(path);
+        return 0;
+    }
+    long errors = file.count != s->count;
+    for (long i = 0; !errors && i < s->count; i++) {
+        Grid grid, solution;
+        gridFileGet(&file, i, &grid);
+        int stored = gridFileSolution(&file, i, &solution);
+        errors += memcmp(&grid, &s->grids[i], sizeof(Grid)) != 0 || stored != (counts[i] > 0) ||
+                  (stored && memcmp(&solution, &solutions[i], sizeof(Grid)) != 0) ||
+                  countGridSolutions(&grid, CHECK_LIMIT) != counts[i];
+    }
+    gridFileClose(&file);
+    report("conteneur .sdkb (gridFileOpen)", errors, s->count);
+
+    GridSet reread;
+    errors = !setLoad(&reread, path) || reread.count != s->count ||
+             memcmp(reread.grids, s->grids, s->count * sizeof(Grid)) != 0;
+    free(reread.grids);
+    report("conteneur .sdkb (lecture en flux)", errors, 1);
+    unlink(path);
+    return 1;
+}
+
+// Forme canonique : même forme pour des copies transformées par symétrie,
+// transformation exacte, et solution retrouvée par le cache pour une copie
+int checkCanonical(const GridSet *s, const int *counts, const Grid *solutions) {
+    SolutionCache cache;
+    if (!cacheInit(&cache, s->count)) return 0;
+    long errors = 0, cacheErrors = 0, checked = 0;
+    for (long i = 0; i < s->count; i++) {
+        if (counts[i] == 0) continue;
+        checked++;
+        CanonicalForm form, other;
+        gridCanonicalize(&s->grids[i], &form);
+        Grid canonical, solution, back;
+        canonApply(&form, &s->grids[i], &canonical);
+        canonApply(&form, &solutions[i], &solution);
+        canonRevert(&form, &solution, &back);
+        int valid = memcmp(&canonical, &form.grid, sizeof(Grid)) == 0 &&
+                    memcmp(&back, &solutions[i], sizeof(Grid)) == 0;
+        if (cacheLookup(&cache, &form, &back) < 0) cacheStore(&cache, &form, &solutions[i]);
+
+        Rng rng;
+        rngSeed(&rng, 1, (uint64_t)i);
+        for (int k = 0; k < CHECK_SHUFFLES; k++) {
+            Grid copy = s->grids[i];
+            gridShuffle(&rng, &copy);
+            gridCanonicalize(&copy, &other);
+            valid &= memcmp(&form.grid, &other.grid, sizeof(Grid)) == 0;
+            Grid found = copy;
+            cacheErrors += cacheLookup(&cache, &other, &found) != 1 || !isSolutionOf(&found, &copy);
+        }
+        errors += !valid;
+    }
+    cacheFree(&cache);
+    report("forme canonique (symétries)", errors, checked);
+    report("cache (copies transformées)", cacheErrors, checked * CHECK_SHUFFLES);
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    const char *path = argc > 1 ? argv[1] : REPO_ROOT "/MPI/sudoku_grids.txt";
+    if (argc > 2) {
+        printf("Usage: %s [fichier|fichier.sdkb]\n", argv[0]);
+        return 1;
+    }
+    GridSet set;
+    if (!setLoad(&set, path)) return 1;
+    if (set.count == 0) {
+        printf("Aucune grille lue dans %s\n", path);
+        free(set.grids);
+        return 1;
+    }
+    printf("%ld grilles %dx%d lues dans %s, %d threads\n", set.count, N, N, path, omp_get_max_threads());
+
+    double start = omp_get_wtime();
+    int *counts = malloc(set.count * sizeof(int));
+    Grid *solutions = malloc(set.count * sizeof(Grid));
+    int ok = counts && solutions;
+    if (ok) {
+        checkCounting(&set, counts);
+        ok = checkEngines(&set, counts, solutions) && checkContainer(&set, counts, solutions) &&
+             checkCanonical(&set, counts, solutions);
+    }
+    if (!ok) printf("Erreur d'allocation mémoire ou de fichier temporaire\n");
+    else printf("%s en %.4f secondes\n", failures ? "Vérifications en échec" : "Toutes les vérifications passent",
+                omp_get_wtime() - start);
+    free(counts);
+    free(solutions);
+    free(set.grids);
+    return !ok ? 1 : failures ? 2 : 0;
+}
@@ -0,0 +1,163 @@
+#ifndef SUDOKU_CACHE_SOLUTIONS_H
+#define SUDOKU_CACHE_SOLUTIONS_H
+
+// Cache des solutions, indexé par la forme canonique des grilles et partagé
+// entre les threads OpenMP.
+//
+// Une grille déjà résolue, ou équivalente à une grille déjà résolue (voir
+// canonique.h), coûte une canonisation et une recherche dans la table au lieu
+// d'une résolution. Les grilles sans solution sont mémorisées aussi.
+//
+// La table, de capacité fixe, est à adressage ouvert et sans verrou : un
+// thread réserve une entrée vide par compare-and-swap sur son état, la
+// remplit puis la publie (release) ; les lecteurs ne lisent que les entrées
+// publiées (acquire). Chaque entrée occupe ses propres lignes de cache : un
+// ajout ne ralentit pas les lectures des autres entrées. Deux threads qui
+// résolvent en même temps la même grille peuvent l'ajouter deux fois (copie
+// inutile, sans danger) ; une entrée qui ne trouve pas de place dans ses
+// CACHE_MAX_PROBES premières positions n'est pas ajoutée.
+//
+// Le cache se sauvegarde dans un conteneur .sdkb (conteneur.h) : formes
+// canoniques et solutions, grille vide pour une grille sans solution. Au
+// chargement, chaque grille est canonisée à nouveau : tout conteneur avec
+// solutions (Outils/convertir, Outils/generer) peut amorcer le cache.
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include "canonique.h"
+#include "conteneur.h"
+
+#define CACHE_MAX_PROBES 32       // Positions essayées au plus par recherche
+#define CACHE_LINE 64
+
+enum { CACHE_EMPTY, CACHE_WRITING, CACHE_READY };
+
+typedef struct {
+    atomic_int state;         // CACHE_EMPTY, CACHE_WRITING ou CACHE_READY
+    int solvable;             // 0 : la grille n'a pas de solution
+    uint64_t hash;            // Empreinte de la forme canonique
+    PackedGrid puzzle;        // Forme canonique
+    PackedGrid solution;      // Sa solution, dans le même repère
+} __attribute__((aligned(CACHE_LINE))) CacheEntry;
+
+typedef struct {
+    CacheEntry *entries;
+    size_t mask;              // Capacité - 1 (puissance de 2)
+    atomic_long size;         // Entrées publiées
+} SolutionCache;
+
+// Table pour environ expected grilles (remplie au plus à moitié). Renvoie 0
+// si la mémoire manque.
+static inline int cacheInit(SolutionCache *c, long expected) {
+    size_t capacity = 64;
+    while (capacity < 2 * (size_t)expected) capacity *= 2;
+    c->entries = aligned_alloc(CACHE_LINE, capacity * sizeof(CacheEntry));
+    if (!c->entries) return 0;
+    memset(c->entries, 0, capacity * sizeof(CacheEntry));  // CACHE_EMPTY
+    c->mask = capacity - 1;
+    atomic_init(&c->size, 0);
+    return 1;
+}
+
+static inline void cacheFree(SolutionCache *c) {
+    free(c->entries);
+    c->entries = NULL;
+}
+
+static inline long cacheSize(SolutionCache *c) {
+    return atomic_load_explicit(&c->size, memory_order_relaxed);
+}
+
+// Cherche la grille de forme canonique form. Renvoie 1 si elle est connue et
+// résolue (sa solution est écrite dans grid, dans le repère de la grille), 0
+// si elle est connue sans solution, -1 si elle est absente.
+static inline int cacheLookup(SolutionCache *c, const CanonicalForm *form, Grid *grid) {
+    PackedGrid key;
+    gridPack(&form->grid, &key);
+    for (size_t probe = 0; probe < CACHE_MAX_PROBES; probe++) {
+        CacheEntry *e = &c->entries[(form->hash + probe) & c->mask];
+        int state = atomic_load_explicit(&e->state, memory_order_acquire);
+        if (state == CACHE_EMPTY) return -1;
+        if (state != CACHE_READY || e->hash != form->hash || memcmp(&e->puzzle, &key, sizeof(key)) != 0)
+            continue;
+        if (!e->solvable) return 0;
+        Grid solution;
+        gridUnpack(&e->solution, &solution);
+        canonRevert(form, &solution, grid);
+        return 1;
+    }
+    return -1;
+}
+
+// Ajoute la grille de forme canonique form avec sa solution (dans le repère
+// de la grille ; NULL si elle n'en a pas). Renvoie 0 si la table est pleine
+// à cet endroit.
+static inline int cacheStore(SolutionCache *c, const CanonicalForm *form, const Grid *solution) {
+    for (size_t probe = 0; probe < CACHE_MAX_PROBES; probe++) {
+        CacheEntry *e = &c->entries[(form->hash + probe) & c->mask];
+        int expected = CACHE_EMPTY;
+        if (atomic_load_explicit(&e->state, memory_order_relaxed) != CACHE_EMPTY ||
+            !atomic_compare_exchange_strong_explicit(&e->state, &expected, CACHE_WRITING,
+                                                     memory_order_acquire, memory_order_relaxed))
+            continue;
+        e->hash = form->hash;
+        e->solvable = solution != NULL;
+        gridPack(&form->grid, &e->puzzle);
+        if (solution) {
+            Grid canonical;
+            canonApply(form, solution, &canonical);
+            gridPack(&canonical, &e->solution);
+        }
+        atomic_store_explicit(&e->state, CACHE_READY, memory_order_release);
+        atomic_fetch_add_explicit(&c->size, 1, memory_order_relaxed);
+        return 1;
+    }
+    return 0;
+}
+
+// Prépare un cache pour environ expected nouvelles grilles, amorcé avec les
+// grilles du conteneur path et leurs solutions (path NULL, fichier absent ou
+// sans solutions : cache vide). Renvoie le nombre de grilles chargées, -1 si
+// la mémoire manque.
+static inline long cacheOpen(SolutionCache *c, long expected, const char *path) {
+    GridFile f;
+    int seeded = path && gridFileOpen(&f, path);
+    if (seeded && !f.solutions) {
+        gridFileClose(&f);
+        seeded = 0;
+    }
+    if (!cacheInit(c, expected + (seeded ? f.count : 0))) {
+        if (seeded) gridFileClose(&f);
+        return -1;
+    }
+    long added = 0;
+    for (long i = 0; seeded && i < f.count; i++) {
+        Grid puzzle, solution, known;
+        CanonicalForm form;
+        gridFileGet(&f, i, &puzzle);
+        gridCanonicalize(&puzzle, &form);
+        int solvable = gridFileSolution(&f, i, &solution);
+        if (cacheLookup(c, &form, &known) < 0) added += cacheStore(c, &form, solvable ? &solution : NULL);
+    }
+    if (seeded) gridFileClose(&f);
+    return added;
+}
+
+// Écrit les entrées du cache dans le conteneur path (hors région parallèle).
+// Renvoie 0 en cas d'erreur d'écriture.
+static inline int cacheSave(SolutionCache *c, const char *path) {
+    GridFileWriter w;
+    if (!gridFileCreate(&w, path, 1)) return 0;
+    int ok = 1;
+    for (size_t i = 0; i <= c->mask && ok; i++) {
+        CacheEntry *e = &c->entries[i];
+        if (atomic_load(&e->state) != CACHE_READY) continue;
+        Grid puzzle, solution;
+        gridUnpack(&e->puzzle, &puzzle);
+        gridUnpack(&e->solution, &solution);
+        ok = gridFileAppend(&w, &puzzle, e->solvable ? &solution : NULL);
+    }
+    return gridFileFinish(&w) && ok;
+}
+
+#endif
@@ -0,0 +1,245 @@
+#ifndef SUDOKU_CANONIQUE_H
+#define SUDOKU_CANONIQUE_H
+
+// Forme canonique d'une grille, pour reconnaître les grilles équivalentes.
+//
+// Deux grilles sont équivalentes si l'une se déduit de l'autre par
+// renumérotation des chiffres, permutation des lignes d'une bande, des
+// bandes, des colonnes d'une pile, des piles, et transposition : la solution
+// de l'une est celle de l'autre, transformée de la même façon.
+//
+// Essayer les 2 × 6^8 transformations d'une grille 9×9 coûterait bien plus
+// qu'une résolution. Les lignes et les colonnes sont donc d'abord rangées
+// selon des invariants qui ne dépendent ni de l'ordre des autres lignes ou
+// colonnes, ni de la numérotation (nombre d'indices, indices des lignes ou
+// colonnes croisées, fréquence des chiffres). Seuls les ordres compatibles
+// avec ce rangement sont essayés (toutes les permutations des ex aequo), dans
+// les deux orientations, les chiffres étant renumérotés par ordre
+// d'apparition ; la forme canonique est la plus petite de ces transformées
+// (ordre lexicographique des cases, ligne par ligne).
+//
+// Au-delà de CANON_MAX_ORDERS ordres pour un axe (grilles presque vides ou
+// très symétriques), les ex aequo restants gardent l'ordre de la grille : la
+// transformation reste exacte, mais deux grilles équivalentes peuvent alors
+// avoir des formes différentes (le cache manque la grille, sans erreur).
+
+#include <stdint.h>
+#include <string.h>
+#include "grille.h"
+
+#define CANON_MAX_ORDERS 8        // Ordres essayés au plus par axe et par orientation
+
+typedef struct {
+    Grid grid;                // Forme canonique
+    uint64_t hash;            // Empreinte de la forme canonique
+    int transposed;           // 1 : la grille est transposée avant permutation
+    uint8_t rows[N];          // Ligne (de la grille orientée) placée en ligne i
+    uint8_t cols[N];          // Colonne placée en colonne j
+    uint8_t digits[N + 1];    // Chiffre d'origine -> chiffre canonique (0 -> 0)
+} CanonicalForm;
+
+// Mélange d'un entier (finaliseur de splitmix64)
+static inline uint64_t canonMix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static inline uint64_t canonHash(const Grid *g) {
+    uint64_t h = 0;
+    for (int idx = 0; idx < NN; idx++)
+        h = canonMix(h ^ ((uint64_t)g->cells[idx] << 8 | (uint64_t)idx));
+    return h;
+}
+
+// Clés des lignes et des colonnes, invariantes par renumérotation et par
+// permutation des autres lignes et colonnes. Une clé mélange le nombre
+// d'indices de la ligne et, pour chacun, les indices de la colonne croisée et
+// la fréquence de son chiffre (somme, indépendante de l'ordre).
+static inline void canonLineKeys(const Grid *g, uint64_t rowKey[N], uint64_t colKey[N]) {
+    int rowCount[N] = {0}, colCount[N] = {0}, digitCount[N + 1] = {0};
+    for (int r = 0; r < N; r++)
+        for (int c = 0; c < N; c++) {
+            int v = g->cells[r * N + c];
+            if (v == 0) continue;
+            rowCount[r]++;
+            colCount[c]++;
+            digitCount[v]++;
+        }
+    for (int k = 0; k < N; k++) {
+        rowKey[k] = (uint64_t)rowCount[k] << 56;
+        colKey[k] = (uint64_t)colCount[k] << 56;
+    }
+    for (int r = 0; r < N; r++)
+        for (int c = 0; c < N; c++) {
+            int v = g->cells[r * N + c];
+            if (v == 0) continue;
+            rowKey[r] += canonMix((uint64_t)colCount[c] << 8 | (uint64_t)digitCount[v]) >> 8;
+            colKey[c] += canonMix((uint64_t)rowCount[r] << 8 | (uint64_t)digitCount[v]) >> 8;
+        }
+}
+
+// Tri par insertion des identifiants ids[0..len) selon key[id] (ex aequo :
+// ordre des identifiants)
+static inline void canonSortIds(uint8_t *ids, int len, const uint64_t *key) {
+    for (int i = 1; i < len; i++) {
+        uint8_t id = ids[i];
+        int j = i;
+        while (j > 0 && key[ids[j - 1]] > key[id]) {
+            ids[j] = ids[j - 1];
+            j--;
+        }
+        ids[j] = id;
+    }
+}
+
+// Remplace items[0..len) par sa index-ième permutation (0 : inchangé)
+static inline void canonPermute(uint8_t *items, int len, int index) {
+    uint8_t pool[BOX];
+    memcpy(pool, items, len);
+    int fact = 1;
+    for (int k = 2; k < len; k++) fact *= k;
+    for (int i = 0; i < len; i++) {
+        int k = index / fact;
+        index %= fact;
+        items[i] = pool[k];
+        memmove(&pool[k], &pool[k + 1], len - 1 - i - k);
+        if (len - 1 - i > 1) fact /= len - 1 - i;
+    }
+}
+
+// Ordres d'un axe (lignes ou colonnes) compatibles avec les clés : bandes
+// rangées selon la somme mélangée des clés de leurs lignes, lignes rangées
+// dans chaque bande, toutes les permutations des ex aequo. Renvoie le nombre
+// d'ordres écrits dans orders (au plus CANON_MAX_ORDERS).
+static inline int canonAxisOrders(const uint64_t key[N], uint8_t orders[CANON_MAX_ORDERS][N]) {
+    // lines[BOX] : les bandes ; lines[b] : les lignes de la bande b
+    uint8_t lines[BOX + 1][BOX];
+    uint64_t bandKey[BOX];
+    for (int b = 0; b < BOX; b++) {
+        bandKey[b] = 0;
+        for (int k = 0; k < BOX; k++) {
+            lines[b][k] = (uint8_t)(b * BOX + k);
+            bandKey[b] += canonMix(key[b * BOX + k]);
+        }
+        canonSortIds(lines[b], BOX, key);
+        lines[BOX][b] = (uint8_t)b;
+    }
+    canonSortIds(lines[BOX], BOX, bandKey);
+
+    // Groupes d'ex aequo : tableau, début, longueur, nombre de permutations
+    struct { uint8_t set, start, len; int perms; } ties[BOX + 1 + BOX * BOX];
+    int numTies = 0;
+    for (int set = 0; set <= BOX; set++) {
+        const uint64_t *k = set == BOX ? bandKey : key;
+        for (int i = 0; i < BOX;) {
+            int j = i + 1;
+            while (j < BOX && k[lines[set][j]] == k[lines[set][i]]) j++;
+            if (j - i > 1) {
+                int perms = 1;
+                for (int m = 2; m <= j - i; m++) perms *= m;
+                ties[numTies].set = (uint8_t)set;
+                ties[numTies].start = (uint8_t)i;
+                ties[numTies].len = (uint8_t)(j - i);
+                ties[numTies].perms = perms;
+                numTies++;
+            }
+            i = j;
+        }
+    }
+
+    // Compteur sur les groupes : chaque valeur donne une permutation de chacun
+    int digit[BOX + 1 + BOX * BOX] = {0};
+    int count = 0;
+    for (;;) {
+        uint8_t work[BOX + 1][BOX];
+        memcpy(work, lines, sizeof(work));
+        for (int t = 0; t < numTies; t++)
+            canonPermute(&work[ties[t].set][ties[t].start], ties[t].len, digit[t]);
+        for (int b = 0; b < BOX; b++)
+            memcpy(&orders[count][b * BOX], work[work[BOX][b]], BOX);
+        if (++count == CANON_MAX_ORDERS) break;
+        int t = 0;
+        while (t < numTies && ++digit[t] == ties[t].perms) digit[t++] = 0;
+        if (t == numTies) break;
+    }
+    return count;
+}
+
+// Essaie l'ordre (rows, cols) de la grille orientée g. Si la transformée
+// renumérotée est plus petite que best (ou si have vaut 0), elle le remplace.
+static inline int canonTry(const Grid *g, const uint8_t *rows, const uint8_t *cols, CanonicalForm *best,
+                           int have) {
+    uint8_t map[N + 1] = {0};
+    uint8_t next = 1;
+    int less = !have;
+    Grid candidate;
+    for (int i = 0; i < N; i++)
+        for (int j = 0; j < N; j++) {
+            int v = g->cells[rows[i] * N + cols[j]];
+            if (v && !map[v]) map[v] = next++;
+            uint8_t c = map[v];
+            if (!less) {
+                if (c > best->grid.cells[i * N + j]) return 0;
+                less = c < best->grid.cells[i * N + j];
+            }
+            candidate.cells[i * N + j] = c;
+        }
+    if (!less) return 0;  // Égale : la première trouvée est gardée
+    best->grid = candidate;
+    memcpy(best->rows, rows, N);
+    memcpy(best->cols, cols, N);
+    // Chiffres absents de la grille : numéros restants, dans l'ordre
+    for (int v = 1; v <= N; v++)
+        if (!map[v]) map[v] = next++;
+    memcpy(best->digits, map, sizeof(map));
+    return 1;
+}
+
+// Calcule la forme canonique de grid et la transformation qui y mène
+static inline void gridCanonicalize(const Grid *grid, CanonicalForm *form) {
+    uint8_t rowOrders[CANON_MAX_ORDERS][N], colOrders[CANON_MAX_ORDERS][N];
+    uint64_t rowKey[N], colKey[N];
+    int have = 0;
+    for (int transposed = 0; transposed < 2; transposed++) {
+        Grid g;
+        for (int r = 0; r < N; r++)
+            for (int c = 0; c < N; c++)
+                g.cells[r * N + c] = transposed ? grid->cells[c * N + r] : grid->cells[r * N + c];
+        canonLineKeys(&g, rowKey, colKey);
+        int numRows = canonAxisOrders(rowKey, rowOrders);
+        int numCols = canonAxisOrders(colKey, colOrders);
+        for (int a = 0; a < numRows; a++)
+            for (int b = 0; b < numCols; b++)
+                if (canonTry(&g, rowOrders[a], colOrders[b], form, have)) {
+                    form->transposed = transposed;
+                    have = 1;
+                }
+    }
+    form->hash = canonHash(&form->grid);
+}
+
+// Transforme src (grille d'origine, par exemple sa solution) comme la forme
+// canonique
+static inline void canonApply(const CanonicalForm *form, const Grid *src, Grid *dst) {
+    for (int i = 0; i < N; i++)
+        for (int j = 0; j < N; j++) {
+            int r = form->rows[i], c = form->cols[j];
+            int idx = form->transposed ? c * N + r : r * N + c;
+            dst->cells[i * N + j] = form->digits[src->cells[idx]];
+        }
+}
+
+// Transformation inverse : src est dans le repère de la forme canonique
+static inline void canonRevert(const CanonicalForm *form, const Grid *src, Grid *dst) {
+    uint8_t inverse[N + 1];
+    for (int v = 0; v <= N; v++) inverse[form->digits[v]] = (uint8_t)v;
+    for (int i = 0; i < N; i++)
+        for (int j = 0; j < N; j++) {
+            int r = form->rows[i], c = form->cols[j];
+            int idx = form->transposed ? c * N + r : r * N + c;
+            dst->cells[idx] = inverse[src->cells[i * N + j]];
+        }
+}
+
+#endif
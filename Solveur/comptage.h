@@ -0,0 +1,117 @@
+#ifndef SUDOKU_COMPTAGE_H
+#define SUDOKU_COMPTAGE_H
+
+// Comptage des solutions d'une grille, jusqu'à une limite.
+//
+// Une grille bien posée a exactement une solution : compter jusqu'à 2 suffit
+// à distinguer 0, 1 ou plusieurs solutions. La recherche itérative
+// (StackSearch) passe d'une solution à la suivante sans repartir de zéro.
+//
+// En parallèle, la grille est découpée en sous-problèmes disjoints ; chaque
+// thread compte les solutions des siens dans un compteur atomique partagé,
+// et tous s'arrêtent (drapeau du SearchControl) dès que la limite est
+// atteinte.
+//
+// À inclure uniquement dans les programmes compilés avec -fopenmp.
+
+#include <omp.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "sudoku_core.h"
+#include "frontiere.h"
+
+#define COUNT_UNIQUE 2         // Limite suffisante pour vérifier l'unicité
+
+// Compte les solutions de b jusqu'à limit (séquentiel). Renvoie -1 si la
+// recherche a été arrêtée par ctl avant d'atteindre la limite.
+static inline int boardCountSolutions(const Board *b, int limit, SearchControl *ctl) {
+    StackSearch s;
+    stackSearchInit(&s, b);
+    int count = 0;
+    while (count < limit) {
+        SearchStatus status = stackSearchRun(&s, ctl);
+        if (status == SEARCH_STOPPED) return -1;
+        if (status == SEARCH_EXHAUSTED) break;
+        count++;
+    }
+    return count;
+}
+
+// Découpage en largeur pour le comptage : contrairement à frontierExpand, une
+// grille complète rencontrée en chemin est comptée (*solutions) et le
+// découpage continue. Renvoie 0 si la mémoire manque.
+static inline int countExpand(Frontier *f, const Board *root, int maxDepth, int targetTasks,
+                              int limit, int *solutions) {
+    f->head = f->tail = 0;
+    f->solved = 0;
+    *solutions = 0;
+    if (!frontierPush(f, root, 0)) return 0;
+
+    while (f->head < f->tail && frontierCount(f) < targetTasks && f->depth[f->head] < maxDepth &&
+           *solutions < limit) {
+        Board parent = f->tasks[f->head];
+        int depth = f->depth[f->head++];
+        if (!boardPropagate(&parent)) continue;
+        if (parent.numEmpty == 0) {
+            (*solutions)++;
+            continue;
+        }
+        int idx = boardPickMRV(&parent);
+        for (Mask cand = boardCandidates(&parent, idx); cand; cand &= cand - 1) {
+            Board child = parent;
+            boardAssign(&child, idx, lowestDigit(cand));
+            if (!frontierPush(f, &child, depth + 1)) return 0;
+        }
+    }
+    return 1;
+}
+
+// Compte les solutions de b jusqu'à limit avec les threads de l'équipe
+// OpenMP créée ici (à appeler hors région parallèle). maxDepth et targetTasks
+// règlent le découpage (0 : valeurs par défaut).
+static inline int parallelCountSolutions(const Board *b, int limit, int maxDepth, int targetTasks) {
+    if (maxDepth <= 0) maxDepth = FRONTIER_MAX_DEPTH;
+    if (targetTasks <= 0) targetTasks = FRONTIER_TASKS_PER_THREAD * omp_get_max_threads();
+
+    Frontier frontier;
+    frontierInit(&frontier);
+    int solutions;
+    if (!countExpand(&frontier, b, maxDepth, targetTasks, limit, &solutions)) {
+        // Mémoire insuffisante : comptage séquentiel
+        frontierFree(&frontier);
+        return boardCountSolutions(b, limit, NULL);
+    }
+
+    atomic_int total, stop;
+    atomic_init(&total, solutions);
+    atomic_init(&stop, solutions >= limit);
+    int tasks = frontierCount(&frontier);
+
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int i = 0; i < tasks; i++) {
+        if (atomic_load_explicit(&stop, memory_order_relaxed)) continue;
+        SearchControl ctl;
+        searchInit(&ctl, &stop);
+        StackSearch s;
+        stackSearchInit(&s, frontierTask(&frontier, i));
+        while (stackSearchRun(&s, &ctl) == SEARCH_SOLVED) {
+            if (atomic_fetch_add(&total, 1) + 1 >= limit) {
+                atomic_store(&stop, 1);
+                break;
+            }
+        }
+    }
+
+    frontierFree(&frontier);
+    int count = atomic_load(&total);
+    return count < limit ? count : limit;
+}
+
+// Comptage sur une Grid : 0 si la grille est incohérente
+static inline int countGridSolutions(const Grid *grid, int limit) {
+    Board b;
+    if (!boardLoad(&b, grid)) return 0;
+    return boardCountSolutions(&b, limit, NULL);
+}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef SUDOKU_COMPTEUR_MPI_H
+#define SUDOKU_COMPTEUR_MPI_H
+
+// Compteur partagé entre processus MPI pour la distribution dynamique du
+// travail.
+//
+// Le compteur vit dans une fenêtre RMA (MPI-3) du processus 0. Chaque
+// processus prend le prochain paquet de travail par un MPI_Fetch_and_op
+// atomique, sans message vers un maître ni participation du processus 0 :
+// un processus tombé sur des grilles difficiles en prend simplement moins.
+//
+// À inclure uniquement dans les programmes compilés avec mpicc.
+
+#include <mpi.h>
+
+typedef struct {
+    MPI_Win win;
+    long *value;              // Mémoire de la fenêtre (processus 0 seulement)
+} WorkCounter;
+
+// Crée le compteur, initialisé à 0 (collectif sur comm)
+static inline void workCounterCreate(WorkCounter *c, MPI_Comm comm) {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Aint bytes = rank == 0 ? (MPI_Aint)sizeof(long) : 0;
+    MPI_Win_allocate(bytes, sizeof(long), MPI_INFO_NULL, comm, &c->value, &c->win);
+    if (rank == 0) {
+        MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, c->win);
+        *c->value = 0;
+        MPI_Win_unlock(0, c->win);
+    }
+    MPI_Barrier(comm);  // Compteur initialisé avant le premier accès
+}
+
+// Renvoie la valeur courante et l'augmente de step
+static inline long workCounterNext(WorkCounter *c, long step) {
+    long previous;
+    MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, c->win);
+    MPI_Fetch_and_op(&step, &previous, MPI_LONG, 0, 0, MPI_SUM, c->win);
+    MPI_Win_unlock(0, c->win);
+    return previous;
+}
+
+// Libère le compteur (collectif)
+static inline void workCounterFree(WorkCounter *c) {
+    MPI_Win_free(&c->win);
+}
+
+#endif
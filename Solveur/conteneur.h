@@ -0,0 +1,160 @@
+#ifndef SUDOKU_CONTENEUR_H
+#define SUDOKU_CONTENEUR_H
+
+// Format binaire de stockage des grilles (extension .sdkb).
+//
+//   en-tête (GridFileHeader, 16 octets)
+//   count grilles PackedGrid (41 octets chacune en 9×9)
+//   count solutions PackedGrid si GRIDFILE_SOLUTIONS (grille vide : pas de
+//   solution)
+//
+// Les enregistrements ont une taille fixe : la grille i se trouve à un
+// décalage connu. Le fichier est projeté en mémoire et lu sans analyse ni
+// copie ; chaque processus MPI ne touche que les pages de sa tranche
+// (gridFileSlice), sans diffusion préalable. Les entiers sont écrits dans
+// l'ordre des octets de la machine (petit-boutiste sur x86).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "grille.h"
+
+#define GRIDFILE_MAGIC "SDKB"
+#define GRIDFILE_VERSION 1
+#define GRIDFILE_SOLUTIONS 0x01   // Section des solutions présente
+
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint8_t box;              // BOX des grilles stockées
+    uint8_t flags;
+    uint64_t count;           // Nombre de grilles
+} GridFileHeader;
+
+typedef struct {
+    const uint8_t *data;      // Fichier projeté
+    size_t size;
+    long count;
+    const PackedGrid *grids;
+    const PackedGrid *solutions;  // NULL sans section des solutions
+} GridFile;
+
+// Projette un fichier .sdkb. Renvoie 0 si le fichier ne peut pas être lu ou
+// n'est pas un conteneur valide pour ce BOX.
+static inline int gridFileOpen(GridFile *f, const char *path) {
+    memset(f, 0, sizeof(*f));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return 0;
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(GridFileHeader)) {
+        close(fd);
+        return 0;
+    }
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return 0;
+    f->data = data;
+    f->size = (size_t)st.st_size;
+
+    // Nombre de grilles comparé par division : un count corrompu ne doit pas
+    // faire déborder le calcul de la taille attendue
+    const GridFileHeader *h = data;
+    int sections = (h->flags & GRIDFILE_SOLUTIONS) ? 2 : 1;
+    if (memcmp(h->magic, GRIDFILE_MAGIC, 4) != 0 || h->version != GRIDFILE_VERSION ||
+        h->box != BOX ||
+        h->count > (f->size - sizeof(*h)) / (sections * sizeof(PackedGrid))) {
+        munmap(data, f->size);
+        memset(f, 0, sizeof(*f));
+        return 0;
+    }
+    f->count = (long)h->count;
+    f->grids = (const PackedGrid *)(f->data + sizeof(*h));
+    if (sections == 2) f->solutions = f->grids + f->count;
+    return 1;
+}
+
+static inline void gridFileClose(GridFile *f) {
+    if (f->data) munmap((void *)f->data, f->size);
+    memset(f, 0, sizeof(*f));
+}
+
+static inline void gridFileGet(const GridFile *f, long i, Grid *grid) {
+    gridUnpack(&f->grids[i], grid);
+}
+
+// Solution stockée de la grille i. Renvoie 0 s'il n'y en a pas.
+static inline int gridFileSolution(const GridFile *f, long i, Grid *solution) {
+    if (!f->solutions) return 0;
+    gridUnpack(&f->solutions[i], solution);
+    return gridClues(solution) == NN;
+}
+
+// Tranche [*first, *first + *count) de la partie part sur parts (découpage en
+// blocs contigus de tailles égales à une grille près)
+static inline void gridFileSlice(const GridFile *f, int part, int parts, long *first, long *count) {
+    long base = f->count / parts, extra = f->count % parts;
+    *first = part * base + (part < extra ? part : extra);
+    *count = base + (part < extra);
+}
+
+// Écriture en flux : les grilles sont ajoutées une à une, les solutions sont
+// mises de côté dans un fichier temporaire et recopiées à la fermeture.
+typedef struct {
+    FILE *out;
+    FILE *solutions;          // NULL sans section des solutions
+    GridFileHeader header;
+} GridFileWriter;
+
+static inline int gridFileCreate(GridFileWriter *w, const char *path, int withSolutions) {
+    memset(w, 0, sizeof(*w));
+    memcpy(w->header.magic, GRIDFILE_MAGIC, 4);
+    w->header.version = GRIDFILE_VERSION;
+    w->header.box = BOX;
+    w->header.flags = withSolutions ? GRIDFILE_SOLUTIONS : 0;
+    w->out = fopen(path, "wb");
+    if (!w->out) return 0;
+    if (withSolutions && !(w->solutions = tmpfile())) {
+        fclose(w->out);
+        return 0;
+    }
+    // En-tête provisoire, réécrit avec le nombre de grilles à la fermeture
+    return fwrite(&w->header, sizeof(w->header), 1, w->out) == 1;
+}
+
+// Ajoute une grille et, si le conteneur en a une section, sa solution (NULL
+// si elle n'en a pas). Renvoie 0 en cas d'erreur d'écriture.
+static inline int gridFileAppend(GridFileWriter *w, const Grid *grid, const Grid *solution) {
+    PackedGrid packed;
+    gridPack(grid, &packed);
+    if (fwrite(&packed, sizeof(packed), 1, w->out) != 1) return 0;
+    if (w->solutions) {
+        if (solution) gridPack(solution, &packed);
+        else memset(&packed, 0, sizeof(packed));
+        if (fwrite(&packed, sizeof(packed), 1, w->solutions) != 1) return 0;
+    }
+    w->header.count++;
+    return 1;
+}
+
+// Recopie les solutions, réécrit l'en-tête et ferme. Renvoie 0 en cas d'erreur.
+static inline int gridFileFinish(GridFileWriter *w) {
+    int ok = 1;
+    if (w->solutions) {
+        char buffer[1 << 16];
+        size_t n;
+        rewind(w->solutions);
+        while ((n = fread(buffer, 1, sizeof(buffer), w->solutions)) > 0)
+            ok &= fwrite(buffer, 1, n, w->out) == n;
+        fclose(w->solutions);
+    }
+    ok &= fseek(w->out, 0, SEEK_SET) == 0;
+    ok &= fwrite(&w->header, sizeof(w->header), 1, w->out) == 1;
+    ok &= fclose(w->out) == 0;
+    return ok;
+}
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef SUDOKU_DIFFICULTE_H
+#define SUDOKU_DIFFICULTE_H
+
+// Estimation de la difficulté des grilles, pour ordonner le travail.
+//
+// Une grille difficile traitée en dernier fixe à elle seule la durée d'un lot.
+// Une pré-passe peu coûteuse essaie chaque grille avec un petit budget de
+// nœuds (gridProbe) : la plupart sont résolues (ou réfutées) dès cet essai.
+// Les autres reçoivent un score estimé à partir de la grille propagée
+// (nombre de cases vides, entropie des candidats) et sont traitées de la plus
+// difficile à la plus facile (difficultySort), les plus longues pouvant être
+// confiées au découpage parallèle d'une grille.
+
+#include <stdlib.h>
+#include "sudoku_core.h"
+
+#define PROBE_NODES 64            // Budget de l'essai de la pré-passe
+
+// log2 approché (linéaire entre deux puissances de 2), x >= 1
+static inline float log2Approx(unsigned x) {
+    int e = 31 - __builtin_clz(x);
+    return (float)e + (float)(x - (1u << e)) / (float)(1u << e);
+}
+
+// Entropie des candidats d'une grille propagée : log2 du nombre de
+// combinaisons restantes (somme des log2 des nombres de candidats)
+static inline float boardEntropy(const Board *b) {
+    float entropy = 0.0f;
+    for (int i = 0; i < b->numEmpty; i++)
+        entropy += log2Approx(b->count[b->empty[i]]);
+    return entropy;
+}
+
+// Essai borné à budget nœuds. Renvoie 1 si la grille est résolue (en place),
+// 0 si elle n'a pas de solution, -1 si le budget est épuisé ; *s garde alors
+// la recherche interrompue, qui peut être reprise au lieu d'être recommencée.
+// *score estime le travail : nœuds visités pour une grille tranchée, budget +
+// cases vides + entropie après propagation sinon (toujours plus grand).
+static inline int gridProbeSearch(StackSearch *s, Grid *grid, unsigned long budget, float *score) {
+    Board b;
+    *score = 0.0f;
+    if (!boardLoad(&b, grid)) return 0;
+    SearchControl ctl;
+    searchInit(&ctl, NULL);
+    ctl.maxNodes = budget;
+    stackSearchInit(s, &b);
+    SearchStatus status = stackSearchRun(s, &ctl);
+    if (status == SEARCH_SOLVED) {
+        boardStore(&s->board, grid);
+        *score = (float)ctl.nodes;
+        return 1;
+    }
+    if (status == SEARCH_EXHAUSTED) {
+        *score = (float)ctl.nodes;
+        return 0;
+    }
+    // Budget épuisé : estimation sur la racine propagée
+    if (!boardPropagate(&b)) return 0;
+    *score = (float)budget + (float)b.numEmpty + boardEntropy(&b);
+    return -1;
+}
+
+static inline int gridProbe(Grid *grid, unsigned long budget, float *score) {
+    StackSearch s;
+    return gridProbeSearch(&s, grid, budget, score);
+}
+
+typedef struct {
+    float score;
+    int index;
+} GridScore;
+
+static inline int gridScoreCompare(const void *a, const void *b) {
+    const GridScore *x = a, *y = b;
+    if (x->score != y->score) return (x->score < y->score) - (x->score > y->score);  // Décroissant
+    return (x->index > y->index) - (x->index < y->index);
+}
+
+// Range dans order les count indices dont les scores sont donnés, du plus
+// difficile au plus facile (à égalité, dans l'ordre d'entrée)
+static inline void difficultySort(const float *scores, const int *indices, int count, int *order) {
+    GridScore *ranked = malloc(count * sizeof(GridScore));
+    if (!ranked) {
+        for (int i = 0; i < count; i++) order[i] = indices[i];
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        ranked[i].score = scores[indices[i]];
+        ranked[i].index = indices[i];
+    }
+    qsort(ranked, count, sizeof(GridScore), gridScoreCompare);
+    for (int i = 0; i < count; i++) order[i] = ranked[i].index;
+    free(ranked);
+}
+
+#endif
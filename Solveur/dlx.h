@@ -0,0 +1,178 @@
+#ifndef SUDOKU_DLX_H
+#define SUDOKU_DLX_H
+
+// Algorithm X de Knuth avec liens dansants (dancing links).
+//
+// Le sudoku est vu comme un problème de couverture exacte : 4 * NN
+// contraintes (case remplie, chiffre dans la ligne, dans la colonne, dans le
+// bloc) et une ligne par couple (case vide, chiffre candidat). Seules les
+// contraintes non satisfaites par les indices sont chaînées, et seuls les
+// candidats du Board donnent une ligne. Tous les nœuds vivent dans des
+// tableaux de taille fixe : aucune allocation pendant la construction ou la
+// recherche.
+
+#include <stdlib.h>
+#include "sudoku_core.h"
+
+#define DLX_COLS (4 * NN)                     // Nombre de contraintes
+#define DLX_ROWS (N * NN)                     // Nombre de couples (case, chiffre)
+#define DLX_NODES (1 + DLX_COLS + 4 * DLX_ROWS)
+
+#if DLX_NODES <= INT16_MAX
+typedef int16_t DlxLink;
+#else
+typedef int32_t DlxLink;                      // 25×25 : plus de 32767 nœuds
+#endif
+
+typedef struct {
+    DlxLink L[DLX_NODES], R[DLX_NODES], U[DLX_NODES], D[DLX_NODES];
+    DlxLink C[DLX_NODES];                     // En-tête de colonne de chaque nœud
+    DlxLink choice[DLX_NODES];                // Couple (case * N + chiffre - 1) du nœud
+    DlxLink size[DLX_COLS + 1];               // Nombre de nœuds par colonne
+    DlxLink solution[NN];                     // Nœuds choisis, un par niveau
+    int depth;
+    int numNodes;
+} Dlx;
+
+// Le nœud 0 est la racine, les nœuds 1..DLX_COLS les en-têtes de colonne
+static inline int dlxHeader(int column) { return column + 1; }
+
+static inline void dlxCover(Dlx *x, int c) {
+    x->R[x->L[c]] = x->R[c];
+    x->L[x->R[c]] = x->L[c];
+    for (int i = x->D[c]; i != c; i = x->D[i]) {
+        for (int j = x->R[i]; j != i; j = x->R[j]) {
+            x->D[x->U[j]] = x->D[j];
+            x->U[x->D[j]] = x->U[j];
+            x->size[x->C[j]]--;
+        }
+    }
+}
+
+static inline void dlxUncover(Dlx *x, int c) {
+    for (int i = x->U[c]; i != c; i = x->U[i]) {
+        for (int j = x->L[i]; j != i; j = x->L[j]) {
+            x->size[x->C[j]]++;
+            x->D[x->U[j]] = j;
+            x->U[x->D[j]] = j;
+        }
+    }
+    x->R[x->L[c]] = c;
+    x->L[x->R[c]] = c;
+}
+
+// Ajoute un nœud en bas de la colonne c et à gauche de first (début de ligne)
+static inline int dlxAppend(Dlx *x, int c, int first, int choice) {
+    int n = x->numNodes++;
+    x->C[n] = c;
+    x->choice[n] = choice;
+    x->U[n] = x->U[c];
+    x->D[n] = c;
+    x->D[x->U[c]] = n;
+    x->U[c] = n;
+    x->size[c]++;
+    if (first < 0) {
+        x->L[n] = x->R[n] = n;
+    } else {
+        x->L[n] = x->L[first];
+        x->R[n] = first;
+        x->R[x->L[first]] = n;
+        x->L[first] = n;
+    }
+    return n;
+}
+
+// Construit la matrice réduite correspondant à l'état du Board
+static inline void dlxBuild(Dlx *x, const Board *b) {
+    x->numNodes = 1 + DLX_COLS;
+    x->depth = 0;
+    x->L[0] = x->R[0] = 0;
+    for (int col = 0; col < DLX_COLS; col++) {
+        int c = dlxHeader(col);
+        x->U[c] = x->D[c] = c;
+        x->C[c] = c;
+        x->size[c] = 0;
+    }
+
+    // Chaîne les seules contraintes encore à satisfaire
+    for (int col = 0; col < DLX_COLS; col++) {
+        int group = col / NN, k = (col % NN) / N, bit = digitBit(col % N + 1);
+        int satisfied;
+        switch (group) {
+        case 0:  satisfied = b->cells[col] != 0; break;
+        case 1:  satisfied = (b->row[k] & bit) != 0; break;
+        case 2:  satisfied = (b->col[k] & bit) != 0; break;
+        default: satisfied = (b->box[k] & bit) != 0; break;
+        }
+        if (satisfied) continue;
+        int c = dlxHeader(col);
+        x->L[c] = x->L[0];
+        x->R[c] = 0;
+        x->R[x->L[0]] = c;
+        x->L[0] = c;
+    }
+
+    for (int idx = 0; idx < NN; idx++) {
+        if (b->cells[idx] != 0) continue;
+        for (Mask cand = boardCandidates(b, idx); cand; cand &= cand - 1) {
+            int d = lowestDigit(cand) - 1;
+            int choice = idx * N + d;
+            int first = dlxAppend(x, dlxHeader(idx), -1, choice);
+            dlxAppend(x, dlxHeader(NN + cellRow(idx) * N + d), first, choice);
+            dlxAppend(x, dlxHeader(2 * NN + cellCol(idx) * N + d), first, choice);
+            dlxAppend(x, dlxHeader(3 * NN + cellBox(idx) * N + d), first, choice);
+        }
+    }
+}
+
+// Recherche récursive ; choisit la colonne ayant le moins de nœuds
+static inline int dlxSearch(Dlx *x, SearchControl *ctl) {
+    if (searchShouldStop(ctl)) return 0;
+    STAT_ADD(nodes, 1);
+    if (x->R[0] == 0) return 1;
+
+    int c = x->R[0];
+    for (int j = x->R[c]; j != 0; j = x->R[j])
+        if (x->size[j] < x->size[c]) c = j;
+    if (x->size[c] == 0) {
+        STAT_ADD(backtracks, 1);
+        return 0;
+    }
+
+    dlxCover(x, c);
+    for (int r = x->D[c]; r != c; r = x->D[r]) {
+        x->solution[x->depth++] = r;
+        STAT_DEPTH(x->depth);
+        for (int j = x->R[r]; j != r; j = x->R[j]) dlxCover(x, x->C[j]);
+        if (dlxSearch(x, ctl)) return 1;
+        for (int j = x->L[r]; j != r; j = x->L[j]) dlxUncover(x, x->C[j]);
+        x->depth--;
+    }
+    dlxUncover(x, c);
+    STAT_ADD(backtracks, 1);
+    return 0;
+}
+
+// Complète le Board avec Algorithm X. Renvoie 1 si une solution existe.
+static inline int boardSolveDlx(Board *b, SearchControl *ctl) {
+#if DLX_NODES <= INT16_MAX
+    Dlx storage;
+    Dlx *x = &storage;
+#else
+    // Plusieurs Mo au-delà du 16×16 : trop pour la pile d'un thread
+    Dlx *x = malloc(sizeof(Dlx));
+    if (!x) return 0;
+#endif
+    dlxBuild(x, b);
+    int found = dlxSearch(x, ctl);
+    for (int i = 0; found && i < x->depth; i++) {
+        int choice = x->choice[x->solution[i]];
+        boardAssign(b, choice / N, choice % N + 1);
+    }
+#if DLX_NODES > INT16_MAX
+    free(x);
+#endif
+    return found;
+}
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef SUDOKU_ECHEANCE_H
+#define SUDOKU_ECHEANCE_H
+
+// Recherche d'une grille par tranches, avec un temps limite par grille.
+//
+// Une grille pathologique ne doit pas bloquer un lot : sa recherche est
+// menée par tranches (budget de nœuds), et l'échéance est vérifiée pendant
+// la recherche elle-même (SearchControl.deadline), pas après coup. Entre deux
+// tranches, l'état complet de la recherche reste dans le SearchJob : la
+// grille peut être remise en file et reprise plus tard, par n'importe quel
+// thread (copie du SearchJob) ou processus (envoi en MPI_BYTE), là où elle
+// s'était arrêtée. Une grille qui dépasse son temps limite est abandonnée.
+
+#include "sudoku_core.h"
+
+#define JOB_SLICE_GROWTH 4        // Facteur d'augmentation du budget d'une tranche à la suivante
+
+typedef struct {
+    int index;                // Numéro de la grille dans son paquet
+    double spent;             // Secondes déjà consacrées à la grille
+    StackSearch search;       // Recherche interrompue, reprise à la tranche suivante
+} SearchJob;
+
+static inline void searchJobInit(SearchJob *job, int index) {
+    job->index = index;
+    job->spent = 0.0;
+}
+
+static inline int searchJobExpired(const SearchJob *job, double timeLimit) {
+    return timeLimit > 0 && job->spent >= timeLimit;
+}
+
+// Poursuit la recherche pendant au plus sliceNodes nœuds, sans dépasser
+// timeLimit secondes au total pour la grille (0 : pas de limite). Après
+// SEARCH_STOPPED, la tranche suivante reprend là où celle-ci s'est arrêtée,
+// sauf si searchJobExpired.
+static inline SearchStatus searchJobRun(SearchJob *job, unsigned long sliceNodes, double timeLimit) {
+    SearchControl ctl;
+    searchInit(&ctl, NULL);
+    ctl.maxNodes = sliceNodes;
+    if (timeLimit > 0) {
+        if (searchJobExpired(job, timeLimit)) return SEARCH_STOPPED;
+        searchSetTimeLimit(&ctl, timeLimit - job->spent);
+    }
+    double start = monotonicSeconds();
+    SearchStatus status = stackSearchRun(&job->search, &ctl);
+    job->spent += monotonicSeconds() - start;
+    return status;
+}
+
+#endif
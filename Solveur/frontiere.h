@@ -0,0 +1,148 @@
+#ifndef SUDOKU_FRONTIERE_H
+#define SUDOKU_FRONTIERE_H
+
+// Découpage d'une recherche en sous-problèmes indépendants.
+//
+// À partir d'une grille propagée, on développe l'arbre de recherche en
+// largeur (case MRV, un fils par candidat, propagation de chaque fils) jusqu'à
+// obtenir assez de grilles partielles ou atteindre la profondeur maximale.
+// Les grilles obtenues couvrent tout l'espace de recherche et sont résolues
+// indépendamment par les threads.
+
+#include <stdlib.h>
+#include "sudoku_core.h"
+
+#define FRONTIER_MAX_DEPTH 20          // Nombre maximal de choix par tâche
+#define FRONTIER_TASKS_PER_THREAD 16   // Nombre de tâches visé par thread
+
+typedef struct {
+    Board *tasks;             // File : tâches en attente dans [head, tail)
+    int *depth;               // Nombre de choix faits pour chaque tâche
+    int head, tail, capacity;
+    int solved;               // 1 si une grille complète est apparue pendant le découpage
+    Board solution;
+} Frontier;
+
+static inline void frontierInit(Frontier *f) {
+    memset(f, 0, sizeof(*f));
+}
+
+static inline void frontierFree(Frontier *f) {
+    free(f->tasks);
+    free(f->depth);
+    frontierInit(f);
+}
+
+static inline int frontierCount(const Frontier *f) { return f->tail - f->head; }
+
+static inline Board *frontierTask(Frontier *f, int i) { return &f->tasks[f->head + i]; }
+
+static inline int frontierPush(Frontier *f, const Board *b, int depth) {
+    if (f->tail == f->capacity) {
+        int capacity = f->capacity ? 2 * f->capacity : 64;
+        Board *tasks = realloc(f->tasks, capacity * sizeof(Board));
+        if (!tasks) return 0;
+        f->tasks = tasks;
+        int *depths = realloc(f->depth, capacity * sizeof(int));
+        if (!depths) return 0;
+        f->depth = depths;
+        f->capacity = capacity;
+    }
+    f->tasks[f->tail] = *b;
+    f->depth[f->tail++] = depth;
+    return 1;
+}
+
+// Découpe la recherche à partir de root (déjà propagé) jusqu'à avoir au moins
+// targetTasks tâches ou que la prochaine tâche à développer ait maxDepth choix.
+// Une frontière vide signifie que la grille n'a pas de solution. Renvoie 0 si
+// la mémoire manque (la frontière est alors incomplète et doit être ignorée).
+static inline int frontierExpand(Frontier *f, const Board *root, int maxDepth, int targetTasks) {
+    f->head = f->tail = 0;
+    f->solved = 0;
+    if (root->numEmpty == 0) {
+        f->solution = *root;
+        f->solved = 1;
+        return 1;
+    }
+    if (!frontierPush(f, root, 0)) return 0;
+
+    while (f->head < f->tail && frontierCount(f) < targetTasks && f->depth[f->head] < maxDepth) {
+        Board parent = f->tasks[f->head];
+        int depth = f->depth[f->head++];
+        int idx = boardPickMRV(&parent);
+
+        for (Mask cand = boardCandidates(&parent, idx); cand; cand &= cand - 1) {
+            Board child = parent;
+            boardAssign(&child, idx, lowestDigit(cand));
+            STAT_ADD(nodes, 1);
+            if (!boardPropagate(&child)) {
+                STAT_ADD(backtracks, 1);
+                continue;  // Branche morte
+            }
+            if (child.numEmpty == 0) {
+                f->solution = child;
+                f->solved = 1;
+                return 1;
+            }
+            if (!frontierPush(f, &child, depth + 1)) return 0;
+        }
+    }
+    return 1;
+}
+
+// Remplace la frontière par les branches encore ouvertes d'une recherche
+// interrompue (SEARCH_STOPPED) : les candidats restants de chaque niveau, du
+// moins profond (les plus gros sous-arbres, pris en premier) au plus profond,
+// puis le nœud courant. Ensemble, elles couvrent exactement ce qu'il restait
+// à explorer : la recherche se poursuit en parallèle sans refaire le travail
+// déjà fait. Les branches ne sont pas propagées (les moteurs le font
+// d'abord). Renvoie 0 si la mémoire manque.
+static inline int frontierFromSearch(Frontier *f, const StackSearch *s) {
+    f->head = f->tail = 0;
+    f->solved = 0;
+    for (int level = 0; level < s->depth; level++) {
+        const SearchFrame *frame = &s->stack[level];
+        if (frame->remaining == 0) continue;
+        // État du niveau : poses plus récentes annulées sur une copie
+        Board base = s->board;
+        boardUndo(&base, frame->mark);
+        for (Mask cand = frame->remaining; cand; cand &= cand - 1) {
+            Board child = base;
+            boardAssign(&child, frame->cell, lowestDigit(cand));
+            if (!frontierPush(f, &child, level + 1)) return 0;
+        }
+    }
+    return !s->descend || frontierPush(f, &s->board, s->depth);
+}
+
+// Développe les premières tâches d'une frontière non propagée (celle de
+// frontierFromSearch : les moins profondes, donc les plus grosses, d'abord)
+// jusqu'à avoir au moins targetTasks tâches ou que la prochaine ait maxDepth
+// choix. Chaque tâche développée est propagée, puis remplacée par un fils
+// non propagé par candidat de sa case MRV. Renvoie 0 si la mémoire manque.
+static inline int frontierRefine(Frontier *f, int maxDepth, int targetTasks) {
+    while (f->head < f->tail && frontierCount(f) < targetTasks && f->depth[f->head] < maxDepth) {
+        Board parent = f->tasks[f->head];
+        int depth = f->depth[f->head++];
+        STAT_ADD(nodes, 1);
+        if (!boardPropagate(&parent)) {
+            STAT_ADD(backtracks, 1);
+            continue;  // Branche morte
+        }
+        if (parent.numEmpty == 0) {
+            f->solution = parent;
+            f->solved = 1;
+            return 1;
+        }
+        int idx = boardPickMRV(&parent);
+        for (Mask cand = boardCandidates(&parent, idx); cand; cand &= cand - 1) {
+            Board child = parent;
+            boardAssign(&child, idx, lowestDigit(cand));
+            if (!frontierPush(f, &child, depth + 1)) return 0;
+        }
+    }
+    return 1;
+}
+
+#endif
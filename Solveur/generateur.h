@@ -0,0 +1,192 @@
+#ifndef SUDOKU_GENERATEUR_H
+#define SUDOKU_GENERATEUR_H
+
+// Génération de grilles à solution unique.
+//
+// - Grille complète : les blocs de la diagonale sont tirés au hasard et
+//   complétés par le solveur, puis la grille est transformée par une
+//   symétrie du sudoku tirée au hasard (permutation des chiffres, des lignes d'une bande, des bandes,
+//   des colonnes d'une pile, des piles, transposition).
+// - Retrait des indices : les cases sont essayées dans un ordre aléatoire ;
+//   un indice n'est retiré que si la grille garde une seule solution. Si les
+//   singletons la résolvent encore, elle est unique ; sinon, la grille étant
+//   unique avant le retrait, une autre solution devrait différer sur la case
+//   retirée : il suffit de chercher une solution avec chacun des autres
+//   candidats de cette case.
+//
+// Chaque grille a son propre générateur pseudo-aléatoire, initialisé à partir
+// de la graine et du numéro de la grille : le résultat ne dépend ni du nombre
+// de threads ni de l'ordre de traitement.
+
+#include "sudoku_core.h"
+
+#define GEN_FILL_NODES 2048       // Budget de la complétion avant nouvel essai
+#define GEN_HARD_ATTEMPTS 64      // Grilles complètes essayées pour GEN_HARD
+
+typedef struct {
+    uint64_t state;
+} Rng;
+
+// splitmix64
+static inline uint64_t rngNext(Rng *r) {
+    uint64_t z = (r->state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Générateur de la grille numéro stream pour une graine donnée
+static inline void rngSeed(Rng *r, uint64_t seed, uint64_t stream) {
+    r->state = seed;
+    r->state = rngNext(r) ^ stream;
+    rngNext(r);
+}
+
+// Entier uniforme dans [0, n)
+static inline int rngBelow(Rng *r, int n) {
+    return (int)((rngNext(r) >> 32) * (uint64_t)n >> 32);
+}
+
+static inline void rngShuffle(Rng *r, int *values, int count) {
+    for (int i = count - 1; i > 0; i--) {
+        int j = rngBelow(r, i + 1);
+        int t = values[i];
+        values[i] = values[j];
+        values[j] = t;
+    }
+}
+
+// Niveau visé
+typedef enum {
+    GEN_ANY,                  // Sans contrainte
+    GEN_EASY,                 // Résolue par les seuls singletons (sans choix)
+    GEN_HARD                  // Les singletons ne suffisent pas
+} GenLevel;
+
+// Permutation aléatoire des lignes (ou colonnes) qui préserve les bandes
+static inline void genLinePermutation(Rng *r, int lines[N]) {
+    int bands[BOX], inner[BOX];
+    for (int k = 0; k < BOX; k++) bands[k] = k;
+    rngShuffle(r, bands, BOX);
+    for (int band = 0; band < BOX; band++) {
+        for (int k = 0; k < BOX; k++) inner[k] = k;
+        rngShuffle(r, inner, BOX);
+        for (int k = 0; k < BOX; k++) lines[band * BOX + k] = bands[band] * BOX + inner[k];
+    }
+}
+
+// Applique une symétrie aléatoire du sudoku à la grille
+static inline void gridShuffle(Rng *r, Grid *g) {
+    int digits[N + 1], rows[N], cols[N];
+    digits[0] = 0;
+    for (int d = 1; d <= N; d++) digits[d] = d;
+    rngShuffle(r, digits + 1, N);
+    genLinePermutation(r, rows);
+    genLinePermutation(r, cols);
+    int transpose = rngBelow(r, 2);
+
+    Grid source = *g;
+    for (int i = 0; i < N; i++)
+        for (int j = 0; j < N; j++) {
+            int idx = transpose ? cols[j] * N + rows[i] : rows[i] * N + cols[j];
+            g->cells[i * N + j] = (uint8_t)digits[source.cells[idx]];
+        }
+}
+
+// Tire une grille complète : les blocs de la diagonale, indépendants, sont
+// remplis au hasard, et le solveur complète le reste
+static inline void generateSolution(Rng *r, Grid *solution) {
+    for (;;) {
+        Grid seedGrid;
+        memset(&seedGrid, 0, sizeof(seedGrid));
+        for (int box = 0; box < BOX; box++) {
+            int digits[N];
+            for (int d = 0; d < N; d++) digits[d] = d + 1;
+            rngShuffle(r, digits, N);
+            for (int k = 0; k < N; k++)
+                seedGrid.cells[(box * BOX + k / BOX) * N + box * BOX + k % BOX] = (uint8_t)digits[k];
+        }
+        Board b;
+        boardLoad(&b, &seedGrid);
+        SearchControl ctl;
+        searchInit(&ctl, NULL);
+        ctl.maxNodes = GEN_FILL_NODES;
+        if (!boardSolvePropagate(&b, &ctl)) continue;  // Budget épuisé : autre tirage
+        boardStore(&b, solution);
+        gridShuffle(r, solution);
+        return;
+    }
+}
+
+// La grille (unique avant le retrait de idx) a-t-elle une solution où idx ne
+// vaut pas value ?
+static inline int genHasOtherSolution(const Grid *puzzle, int idx, int value) {
+    Board b;
+    if (!boardLoad(&b, puzzle)) return 0;
+    Mask cand = boardCandidates(&b, idx) & (Mask)~digitBit(value);
+    for (; cand; cand &= cand - 1) {
+        Board attempt = b;
+        boardAssign(&attempt, idx, lowestDigit(cand));
+        if (boardSolvePropagate(&attempt, NULL)) return 1;
+    }
+    return 0;
+}
+
+// Les singletons seuls résolvent-ils la grille ?
+static inline int genSolvedBySingles(const Grid *puzzle) {
+    Board b;
+    return boardLoad(&b, puzzle) && boardPropagate(&b) && b.numEmpty == 0;
+}
+
+// Retire des indices de solution jusqu'à targetClues indices (0 : autant que
+// possible) en gardant une solution unique. Renvoie le nombre d'indices
+// restants, plus grand que targetClues si aucun retrait n'est plus possible.
+static inline int generatePuzzle(Rng *r, const Grid *solution, int targetClues, GenLevel level,
+                                 Grid *puzzle) {
+    int order[NN];
+    for (int i = 0; i < NN; i++) order[i] = i;
+    rngShuffle(r, order, NN);
+
+    *puzzle = *solution;
+    int clues = NN;
+    int singles = 1;          // La grille courante est résolue par les singletons
+    for (int k = 0; k < NN && clues > targetClues; k++) {
+        int idx = order[k];
+        int value = puzzle->cells[idx];
+        puzzle->cells[idx] = 0;
+        // Des singletons qui résolvent la grille sont des déductions forcées :
+        // la solution est unique sans autre recherche. Une grille qu'ils ne
+        // résolvent pas ne le sera pas non plus avec moins d'indices.
+        int keep;
+        if (singles && genSolvedBySingles(puzzle)) {
+            keep = 0;
+        } else if (level == GEN_EASY) {
+            keep = 1;
+        } else {
+            keep = genHasOtherSolution(puzzle, idx, value);
+            if (!keep) singles = 0;
+        }
+        if (keep) puzzle->cells[idx] = (uint8_t)value;
+        else clues--;
+    }
+    return clues;
+}
+
+// Génère la grille numéro index de la graine seed (et sa solution). GEN_HARD
+// est au mieux : si les GEN_HARD_ATTEMPTS grilles essayées restent résolues
+// par les singletons (fréquent avec beaucoup d'indices), la dernière est
+// renvoyée, à repérer avec genSolvedBySingles.
+static inline int generateGrid(uint64_t seed, uint64_t index, int targetClues, GenLevel level,
+                               Grid *puzzle, Grid *solution) {
+    Rng r;
+    rngSeed(&r, seed, index);
+    int clues = 0;
+    for (int attempt = 0; attempt < GEN_HARD_ATTEMPTS; attempt++) {
+        generateSolution(&r, solution);
+        clues = generatePuzzle(&r, solution, targetClues, level, puzzle);
+        if (level != GEN_HARD || !genSolvedBySingles(puzzle)) break;
+    }
+    return clues;
+}
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef SUDOKU_GRILLE_H
+#define SUDOKU_GRILLE_H
+
+// Représentations compactes d'une grille.
+//
+// Grid (un octet par case, 81 octets) est la forme utilisée partout : solveurs,
+// chargeurs et messages MPI. PackedGrid (4 bits par case, 41 octets) sert au
+// transport. Les tableaux int[N][N] ne subsistent qu'aux bords (grilles écrites
+// en dur dans le code) via gridFromMatrix / gridToMatrix.
+//
+// La taille des grilles est fixée à la compilation : BOX vaut 3 par défaut
+// (9×9) ; -DBOX=4 ou -DBOX=5 donne des programmes pour les grilles 16×16 ou
+// 25×25. Tout le code est spécialisé pour cette taille (masques, boucles,
+// tableaux) : le 9×9 n'a aucun surcoût.
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef BOX
+#define BOX 3                 // Taille d'un bloc
+#endif
+#if BOX < 3 || BOX > 5
+#error "BOX doit valoir 3, 4 ou 5"
+#endif
+#define N (BOX * BOX)         // Taille des sudoku
+#define NN (N * N)            // Nombre de cases
+
+typedef struct {
+    uint8_t cells[NN];        // 0 = case vide, 1..N sinon (ordre ligne par ligne)
+} Grid;
+
+// Au-delà de 15, une case ne tient plus sur 4 bits : un octet par case
+#if N <= 15
+typedef struct {
+    uint8_t nibbles[(NN + 1) / 2];  // Case 2i dans les 4 bits de poids faible
+} PackedGrid;
+#else
+typedef struct {
+    uint8_t cells[NN];
+} PackedGrid;
+#endif
+
+static inline void gridFromMatrix(Grid *g, int m[N][N]) {
+    for (int idx = 0; idx < NN; idx++)
+        g->cells[idx] = (uint8_t)m[idx / N][idx % N];
+}
+
+static inline void gridToMatrix(const Grid *g, int m[N][N]) {
+    for (int idx = 0; idx < NN; idx++)
+        m[idx / N][idx % N] = g->cells[idx];
+}
+
+static inline void gridPack(const Grid *g, PackedGrid *p) {
+#if N <= 15
+    for (int i = 0; i < NN / 2; i++)
+        p->nibbles[i] = (uint8_t)(g->cells[2 * i] | (g->cells[2 * i + 1] << 4));
+    if (NN % 2)
+        p->nibbles[NN / 2] = g->cells[NN - 1];
+#else
+    memcpy(p->cells, g->cells, NN);
+#endif
+}
+
+static inline void gridUnpack(const PackedGrid *p, Grid *g) {
+#if N <= 15
+    for (int i = 0; i < NN / 2; i++) {
+        g->cells[2 * i] = p->nibbles[i] & 0x0F;
+        g->cells[2 * i + 1] = p->nibbles[i] >> 4;
+    }
+    if (NN % 2)
+        g->cells[NN - 1] = p->nibbles[NN / 2] & 0x0F;
+#else
+    memcpy(g->cells, p->cells, NN);
+#endif
+}
+
+// Formats texte : un caractère par case, '.' (ou '0') pour une case vide,
+// '1' à '9' puis 'A' (10), 'B' (11)... pour les grilles de plus de 9 chiffres.
+static inline char cellChar(int value) {
+    if (value == 0) return '.';
+    return value <= 9 ? (char)('0' + value) : (char)('A' + value - 10);
+}
+
+// Valeur d'un caractère de case, -1 s'il n'en désigne pas une
+static inline int cellValue(char c) {
+    if (c == '.') return 0;
+    if (c >= '0' && c <= '9') return c - '0' <= N ? c - '0' : -1;
+    if (N > 9 && c >= 'A' && c < 'A' + N - 9) return c - 'A' + 10;
+    if (N > 9 && c >= 'a' && c < 'a' + N - 9) return c - 'a' + 10;
+    return -1;
+}
+
+// Nombre de cases remplies
+static inline int gridClues(const Grid *g) {
+    int count = 0;
+    for (int idx = 0; idx < NN; idx++)
+        count += g->cells[idx] != 0;
+    return count;
+}
+
+#endif
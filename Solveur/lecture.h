@@ -0,0 +1,263 @@
+#ifndef SUDOKU_LECTURE_H
+#define SUDOKU_LECTURE_H
+
+// Lecture en flux de fichiers de grilles, sans limite de nombre.
+//
+// Le fichier est projeté en mémoire (mmap) et parcouru par un analyseur écrit
+// à la main, sans allocation ni copie de ligne. Les formats existants sont
+// tous reconnus, car seuls comptent les caractères de case :
+// - une grille de NN caractères par ligne ("4.....8.5.3..." ou "400000805...") ;
+// - les blocs "Grille N:" de sudoku_grids.txt (chiffres ou '.' séparés par
+//   des espaces) ;
+// - les fichiers de Sudoku_txt (une grille, chiffres séparés par des espaces).
+// Un caractère de case (cellValue : chiffre, lettre au-delà de 9, ou '.')
+// remplit la case suivante ; espaces, tabulations, virgules et fins de ligne
+// sont ignorés ; une ligne contenant tout autre caractère (en-tête
+// "Grille N:", commentaire '#') est sautée en entier. Dans un fichier d'une
+// grille par ligne, chaque grille se termine à sa fin de ligne : une ligne
+// qui n'a pas exactement NN cases est sautée et comptée (skipped), sans
+// décaler les grilles suivantes.
+//
+// Un fichier peut aussi être lu par tranches d'octets (readerRange), chacune
+// par un processus différent, sans parcourir ce qui précède : une grille
+// appartient à la tranche où elle commence. Son début se reconnaît selon la
+// disposition du fichier, déterminée à l'ouverture sur ses premières lignes
+// (ReaderLayout).
+//
+// Un conteneur binaire .sdkb (conteneur.h), reconnu à son en-tête, est lu de
+// la même façon : les grilles sont décodées en place, sans analyse de texte,
+// et une tranche est alors un paquet de READ_CHUNK grilles.
+
+#include <stddef.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "grille.h"
+#include "conteneur.h"
+
+#define READ_CHUNK 4096       // Grilles par paquet transmis aux solveurs
+#define READ_BLOCK ((size_t)READ_CHUNK * (NN + 1))  // Octets par tranche (un paquet de lignes)
+
+typedef enum {
+    READER_LINES,             // Une grille par ligne : chaque ligne en commence une
+    READER_HEADERS,           // Grilles précédées d'un en-tête ("Grille N:")
+    READER_SINGLE             // Grille sur plusieurs lignes sans en-tête : pas de découpage
+} ReaderLayout;
+
+typedef struct {
+    const char *data;         // Fichier projeté (NULL si le fichier est vide)
+    size_t size;
+    size_t pos;               // Prochain octet à analyser
+    size_t limit;             // Aucune grille commençant à partir d'ici n'est lue
+    long count;               // Grilles lues jusqu'ici
+    long skipped;             // Lignes de cases sautées (pas exactement NN cases)
+    ReaderLayout layout;
+    GridFile container;       // Conteneur .sdkb (container.data non NULL) : pos
+                              // et limit comptent alors des grilles
+} GridReader;
+
+static inline int readerSeparator(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == ',';
+}
+
+// Analyse la ligne commençant en pos : nombre de cases, -1 si elle contient
+// un autre caractère (en-tête ou commentaire). *next reçoit le début de la
+// ligne suivante.
+static inline int readerLine(const GridReader *r, size_t pos, size_t *next) {
+    int cells = 0;
+    while (pos < r->size && r->data[pos] != '\n') {
+        char c = r->data[pos++];
+        if (cellValue(c) >= 0) cells++;
+        else if (!readerSeparator(c)) cells = -1;
+        if (cells < 0) break;
+    }
+    while (pos < r->size && r->data[pos] != '\n') pos++;
+    *next = pos < r->size ? pos + 1 : pos;
+    return cells;
+}
+
+// Disposition du fichier, d'après la première ligne de cases et ce qui la
+// précède
+static inline ReaderLayout readerLayout(const GridReader *r) {
+    int header = 0;
+    size_t pos = 0, next;
+    while (pos < r->size) {
+        int cells = readerLine(r, pos, &next);
+        if (cells < 0) header = 1;
+        else if (cells == NN) return READER_LINES;
+        else if (cells > 0) return header ? READER_HEADERS : READER_SINGLE;
+        pos = next;
+    }
+    return READER_LINES;
+}
+
+// Premier caractère significatif de la ligne commençant en pos : 1 pour une
+// case, -1 pour un autre caractère, 0 pour une ligne vide
+static inline int readerLineKind(const GridReader *r, size_t pos) {
+    while (pos < r->size && readerSeparator(r->data[pos])) pos++;
+    if (pos == r->size || r->data[pos] == '\n') return 0;
+    return cellValue(r->data[pos]) >= 0 ? 1 : -1;
+}
+
+static inline size_t readerNextLine(const GridReader *r, size_t pos) {
+    const char *eol = memchr(r->data + pos, '\n', r->size - pos);
+    return eol ? (size_t)(eol - r->data) + 1 : r->size;
+}
+
+// La ligne commençant en pos ouvre-t-elle une grille ? Une ligne de cases,
+// ou un en-tête suivi (après d'éventuelles lignes vides) d'une ligne de cases
+static inline int readerOpensGrid(const GridReader *r, size_t pos) {
+    int kind = readerLineKind(r, pos);
+    if (r->layout == READER_LINES || kind >= 0) return kind > 0 && r->layout == READER_LINES;
+    do pos = readerNextLine(r, pos);
+    while (pos < r->size && (kind = readerLineKind(r, pos)) == 0);
+    return kind > 0;
+}
+
+// Début de la première grille qui commence à partir de l'octet offset (taille
+// du fichier s'il n'y en a pas)
+static inline size_t readerBoundary(const GridReader *r, size_t offset) {
+    if (offset >= r->size) return r->size;
+    if (r->layout == READER_SINGLE) return offset == 0 ? 0 : r->size;
+    size_t pos = offset;
+    if (pos > 0 && r->data[pos - 1] != '\n') pos = readerNextLine(r, pos);
+    while (pos < r->size && !readerOpensGrid(r, pos)) pos = readerNextLine(r, pos);
+    return pos;
+}
+
+// Ouvre et projette le fichier. Renvoie 0 en cas d'erreur (errno est positionné).
+static inline int readerOpen(GridReader *r, const char *path) {
+    r->data = NULL;
+    r->size = r->pos = r->limit = 0;
+    r->count = r->skipped = 0;
+    r->layout = READER_LINES;
+    if (gridFileOpen(&r->container, path)) {
+        r->limit = (size_t)r->container.count;
+        return 1;
+    }
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return 0;
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return 0;
+    }
+    r->size = (size_t)st.st_size;
+    if (r->size > 0) {
+        void *data = mmap(NULL, r->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            return 0;
+        }
+        madvise(data, r->size, MADV_SEQUENTIAL);
+        r->data = data;
+    }
+    close(fd);  // La projection reste valide
+    r->limit = r->size;
+    if (r->data) r->layout = readerLayout(r);
+    return 1;
+}
+
+static inline void readerClose(GridReader *r) {
+    if (r->container.data) gridFileClose(&r->container);
+    if (r->data) munmap((void *)r->data, r->size);
+    r->data = NULL;
+    r->size = r->pos = r->limit = 0;
+}
+
+// Nombre de tranches de READ_BLOCK octets (de READ_CHUNK grilles pour un
+// conteneur)
+static inline long readerBlocks(const GridReader *r) {
+    if (r->container.data) return (r->container.count + READ_CHUNK - 1) / READ_CHUNK;
+    return (long)((r->size + READ_BLOCK - 1) / READ_BLOCK);
+}
+
+// Limite la lecture aux grilles qui commencent dans la tranche block : la
+// lecture part du début de la première d'entre elles, sans analyser ce qui
+// précède.
+static inline void readerRange(GridReader *r, long block) {
+    if (r->container.data) {
+        size_t count = (size_t)r->container.count;
+        r->pos = (size_t)block * READ_CHUNK < count ? (size_t)block * READ_CHUNK : count;
+        r->limit = r->pos + READ_CHUNK < count ? r->pos + READ_CHUNK : count;
+        return;
+    }
+    size_t start = (size_t)block * READ_BLOCK;
+    size_t end = start + READ_BLOCK < r->size ? start + READ_BLOCK : r->size;
+    r->pos = readerBoundary(r, start);
+    r->limit = end;
+}
+
+// Disposition READER_LINES : la grille suivante est la prochaine ligne de NN
+// cases. Les autres lignes de cases sont sautées et comptées dans skipped.
+static inline int readerNextOnLine(GridReader *r, Grid *grid) {
+    while (r->pos < r->limit) {
+        size_t start = r->pos, next;
+        int cells = readerLine(r, start, &next);
+        r->pos = next;
+        if (cells == NN) {
+            int idx = 0;
+            for (size_t k = start; idx < NN; k++) {
+                int value = cellValue(r->data[k]);
+                if (value >= 0) grid->cells[idx++] = (uint8_t)value;
+            }
+            r->count++;
+            return 1;
+        }
+        if (cells > 0) r->skipped++;
+    }
+    return 0;
+}
+
+// Lit la grille suivante. Renvoie 1 si une grille a été lue, 0 à la fin du
+// fichier (ou de la tranche), -1 si le fichier se termine au milieu d'une
+// grille écrite sur plusieurs lignes.
+static inline int readerNext(GridReader *r, Grid *grid) {
+    if (r->container.data) {
+        if (r->pos >= r->limit) return 0;
+        gridFileGet(&r->container, (long)r->pos++, grid);
+        r->count++;
+        return 1;
+    }
+    if (r->data == NULL) return 0;
+    if (r->layout == READER_LINES) return readerNextOnLine(r, grid);
+    if (r->limit < r->size) {
+        // Lecture d'une tranche : la grille suivante doit y commencer
+        r->pos = readerBoundary(r, r->pos);
+        if (r->pos >= r->limit) return 0;
+    }
+    const char *p = r->data + r->pos, *end = r->data + r->size;
+    int idx = 0, lineStart = 0;  // idx au début de la ligne courante
+    while (p < end && idx < NN) {
+        char c = *p;
+        int value = cellValue(c);
+        if (value >= 0) {
+            grid->cells[idx++] = (uint8_t)value;
+        } else if (c == '\n') {
+            lineStart = idx;
+        } else if (!readerSeparator(c)) {
+            // Ligne d'en-tête ou commentaire : ses cases éventuelles sont
+            // oubliées
+            idx = lineStart;
+            while (p < end && *p != '\n') p++;
+            continue;
+        }
+        p++;
+    }
+    r->pos = (size_t)(p - r->data);
+    if (idx == NN) {
+        r->count++;
+        return 1;
+    }
+    return idx == 0 ? 0 : -1;
+}
+
+// Lit jusqu'à max grilles. Renvoie le nombre de grilles lues (0 à la fin).
+static inline int readerChunk(GridReader *r, Grid *grids, int max) {
+    int count = 0;
+    while (count < max && readerNext(r, &grids[count]) == 1) count++;
+    return count;
+}
+
+#endif
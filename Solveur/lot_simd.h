@@ -0,0 +1,154 @@
+#ifndef SUDOKU_LOT_SIMD_H
+#define SUDOKU_LOT_SIMD_H
+
+// Résolution par lots : BATCH_LANES grilles avancent ensemble, une grille par
+// voie d'un vecteur.
+//
+// Les candidats sont rangés case par case : cand[idx] contient le masque de
+// la case idx pour chaque grille du lot. La propagation (singletons nus puis
+// cachés) s'applique alors à toutes les grilles avec les mêmes instructions
+// vectorielles (extensions vectorielles de GCC : AVX2 avec -mavx2, SSE2
+// sinon). Les voies sont masquées au fil de l'eau : une grille contradictoire
+// ne modifie plus rien, et celles qui demandent un choix sont terminées par
+// le moteur scalaire à partir des déductions faites en lot.
+
+#include "solveur.h"
+
+#ifdef __AVX2__
+#define BATCH_BYTES 32
+#else
+#define BATCH_BYTES 16
+#endif
+#define BATCH_LANES ((int)(BATCH_BYTES / sizeof(Mask)))
+
+typedef Mask MaskVec __attribute__((vector_size(BATCH_BYTES)));
+
+typedef struct {
+    MaskVec cand[NN];
+    MaskVec done[NN];         // Singletons déjà retirés des voisins
+    MaskVec dead;             // Voie à ALL_DIGITS : grille contradictoire
+} Batch;
+
+static inline MaskVec batchSplat(Mask m) {
+    MaskVec v;
+    for (int lane = 0; lane < BATCH_LANES; lane++) v[lane] = m;
+    return v;
+}
+
+static inline int batchAny(MaskVec v) {
+    Mask any = 0;
+    for (int lane = 0; lane < BATCH_LANES; lane++) any |= v[lane];
+    return any != 0;
+}
+
+// Voies à ALL_DIGITS (tous les bits) là où la condition est vraie
+#define BATCH_WHERE(cond) ((MaskVec)(cond))
+
+// Charge count grilles (count <= BATCH_LANES) ; les voies en trop sont mortes
+static inline void batchLoad(Batch *batch, const Grid *grids, int count) {
+    MaskVec all = batchSplat(ALL_DIGITS);
+    batch->dead = batchSplat(0);
+    for (int idx = 0; idx < NN; idx++) {
+        batch->cand[idx] = all;
+        batch->done[idx] = batchSplat(0);
+    }
+    for (int lane = 0; lane < BATCH_LANES; lane++) {
+        if (lane >= count) {
+            batch->dead[lane] = (Mask)~0;
+            continue;
+        }
+        for (int idx = 0; idx < NN; idx++) {
+            int d = grids[lane].cells[idx];
+            if (d > N) batch->dead[lane] = (Mask)~0;
+            else if (d) batch->cand[idx][lane] = digitBit(d);
+        }
+    }
+}
+
+// Retire des voisins de idx le chiffre des voies où idx est devenu un
+// singleton depuis le dernier passage
+static inline void batchEliminate(Batch *batch, int idx) {
+    MaskVec v = batch->cand[idx];
+    MaskVec single = v & BATCH_WHERE((v & (v - 1)) == 0) & ~batch->done[idx];
+    if (!batchAny(single)) return;
+    batch->done[idx] |= single;
+    MaskVec keep = ~single;
+    int r = cellRow(idx), c = cellCol(idx);
+    int br = r - r % BOX, bc = c - c % BOX;
+    for (int k = 0; k < N; k++) {
+        if (k != c) batch->cand[r * N + k] &= keep;
+        if (k != r) batch->cand[k * N + c] &= keep;
+    }
+    for (int i = br; i < br + BOX; i++)
+        for (int j = bc; j < bc + BOX; j++)
+            if (i != r && j != c)
+                batch->cand[i * N + j] &= keep;
+}
+
+// Singletons cachés de l'unité u pour toutes les voies
+static inline void batchHiddenSingles(Batch *batch, int u) {
+    MaskVec once = batchSplat(0), twice = batchSplat(0);
+    for (int k = 0; k < N; k++) {
+        MaskVec v = batch->cand[unitCell(u, k)];
+        twice |= once & v;
+        once |= v;
+    }
+    // Un chiffre sans place dans l'unité : grille contradictoire
+    batch->dead |= BATCH_WHERE(once != batchSplat(ALL_DIGITS));
+    MaskVec hidden = once & ~twice;
+    if (!batchAny(hidden)) return;
+    for (int k = 0; k < N; k++) {
+        MaskVec *v = &batch->cand[unitCell(u, k)];
+        MaskVec hit = *v & hidden;
+        *v = (hit & BATCH_WHERE(hit != 0)) | (*v & BATCH_WHERE(hit == 0));
+    }
+}
+
+// Propagation jusqu'à point fixe sur toutes les voies vivantes
+static inline void batchPropagate(Batch *batch) {
+    MaskVec before[NN];
+    for (;;) {
+        memcpy(before, batch->cand, sizeof(before));
+        for (int idx = 0; idx < NN; idx++) batchEliminate(batch, idx);
+        for (int u = 0; u < 3 * N; u++) batchHiddenSingles(batch, u);
+
+        // Voies dont au moins une case a changé pendant ce passage
+        MaskVec changed = batchSplat(0);
+        for (int idx = 0; idx < NN; idx++) {
+            batch->dead |= BATCH_WHERE(batch->cand[idx] == 0);
+            changed |= BATCH_WHERE(batch->cand[idx] != before[idx]);
+        }
+        if (!batchAny(changed & ~batch->dead)) return;
+    }
+}
+
+// Résout count grilles en place (count <= BATCH_LANES) ; ok[i] vaut 1 si la
+// grille i a été résolue. Renvoie le nombre de grilles résolues.
+static inline int batchSolve(Grid *grids, int *ok, int count, SolverBackend backend) {
+    Batch batch;
+    batchLoad(&batch, grids, count);
+    batchPropagate(&batch);
+
+    int solved = 0;
+    for (int lane = 0; lane < count; lane++) {
+        ok[lane] = 0;
+        if (batch.dead[lane]) continue;
+        int complete = 1;
+        Grid deduced;
+        for (int idx = 0; idx < NN; idx++) {
+            Mask m = batch.cand[idx][lane];
+            int single = (m & (m - 1)) == 0;
+            deduced.cells[idx] = single ? lowestDigit(m) : 0;
+            complete &= single;
+        }
+        // Voie à brancher : le moteur scalaire repart des déductions du lot
+        if (complete || solveGridWith(&deduced, backend)) {
+            grids[lane] = deduced;
+            ok[lane] = 1;
+            solved++;
+        }
+    }
+    return solved;
+}
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef SUDOKU_MEMOIRE_MPI_H
+#define SUDOKU_MEMOIRE_MPI_H
+
+// Mémoire partagée entre les processus MPI d'un même nœud (MPI-3).
+//
+// Les processus d'un nœud sont regroupés par MPI_Comm_split_type ; le premier
+// de chaque nœud (son « chef ») alloue une fenêtre MPI_Win_allocate_shared
+// dont tous les processus du nœud lisent et écrivent directement la mémoire.
+// Une seule copie des données existe ainsi par nœud, et seuls les chefs
+// communiquent d'un nœud à l'autre (communicateur leaders).
+//
+// À inclure uniquement dans les programmes compilés avec mpicc.
+
+#include <mpi.h>
+
+typedef struct {
+    MPI_Comm node;            // Processus du même nœud
+    MPI_Comm leaders;         // Un processus par nœud (MPI_COMM_NULL ailleurs)
+    int nodeRank, nodeSize;
+} NodeComms;
+
+// Collectif sur comm. Le processus 0 de comm est le chef de son nœud.
+static inline void nodeCommsCreate(NodeComms *nc, MPI_Comm comm) {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nc->node);
+    MPI_Comm_rank(nc->node, &nc->nodeRank);
+    MPI_Comm_size(nc->node, &nc->nodeSize);
+    MPI_Comm_split(comm, nc->nodeRank == 0 ? 0 : MPI_UNDEFINED, rank, &nc->leaders);
+}
+
+static inline void nodeCommsFree(NodeComms *nc) {
+    if (nc->leaders != MPI_COMM_NULL) MPI_Comm_free(&nc->leaders);
+    MPI_Comm_free(&nc->node);
+}
+
+// Alloue bytes octets partagés par le nœud (collectif sur nc->node) et renvoie
+// leur adresse dans ce processus. La fenêtre est ouverte en accès passif
+// (MPI_Win_lock_all) : utiliser nodeSync autour des barrières.
+static inline void *nodeSharedAlloc(NodeComms *nc, MPI_Aint bytes, MPI_Win *win) {
+    void *base;
+    MPI_Win_allocate_shared(nc->nodeRank == 0 ? bytes : 0, 1, MPI_INFO_NULL, nc->node, &base, win);
+    MPI_Aint size;
+    int unit;
+    MPI_Win_shared_query(*win, 0, &size, &unit, &base);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, *win);
+    return base;
+}
+
+static inline void nodeSharedFree(MPI_Win *win) {
+    MPI_Win_unlock_all(*win);
+    MPI_Win_free(win);
+}
+
+// Rend visibles à tout le nœud les écritures faites avant l'appel
+static inline void nodeSync(NodeComms *nc, MPI_Win win) {
+    MPI_Win_sync(win);
+    MPI_Barrier(nc->node);
+    MPI_Win_sync(win);
+}
+
+#endif
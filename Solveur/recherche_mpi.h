@@ -0,0 +1,297 @@
+#ifndef SUDOKU_RECHERCHE_MPI_H
+#define SUDOKU_RECHERCHE_MPI_H
+
+// Recherche distribuée d'une seule grille entre processus MPI.
+//
+// - Tous les processus développent la même frontière (frontiere.h) à partir
+//   de la même racine : les tâches n'ont pas à être envoyées.
+// - Un compteur partagé (compteur_mpi.h) distribue dynamiquement les tâches.
+// - Chaque tâche est explorée par tranches de DIST_SLICE_NODES nœuds avec une
+//   StackSearch ; entre deux tranches, le processus traite ses messages.
+// - Un processus sans travail vole chez un autre : la victime lui donne la
+//   branche encore ouverte la moins profonde de sa pile.
+// - Un second compteur suit les unités de travail non terminées (tâches et
+//   branches données). Le processus qui trouve une solution, ou qui termine la
+//   dernière unité, envoie un message de fin à tous les autres.
+//
+// Tous les messages sont envoyés en mode synchrone non bloquant (MPI_Issend) ;
+// un processus n'entre dans la barrière finale (MPI_Ibarrier) qu'une fois ses
+// envois reçus et sa demande de vol éventuelle servie, en continuant à
+// traiter ses messages : aucun message n'est perdu à la fin.
+//
+// À inclure uniquement dans les programmes compilés avec mpicc.
+
+#include <mpi.h>
+#include <stdlib.h>
+#include "sudoku_core.h"
+#include "frontiere.h"
+#include "compteur_mpi.h"
+
+#define DIST_SLICE_NODES 4096       // Nœuds explorés entre deux traitements des messages
+#define DIST_TASKS_PER_RANK 64      // Tâches de la frontière visées par processus
+
+enum {
+    TAG_DIST_STEAL,           // Demande de vol
+    TAG_DIST_WORK,            // Branche donnée (PackedGrid)
+    TAG_DIST_NOWORK,          // Refus
+    TAG_DIST_END,             // Fin de la recherche
+    TAG_DIST_SOLUTION         // Solution envoyée au processus 0 (PackedGrid)
+};
+
+typedef struct {
+    MPI_Comm comm;            // Copie privée du communicateur
+    int rank, size;
+    MPI_Request *sendReq;     // Envois en cours (au plus 2 * size + 2)
+    PackedGrid *sendBuf;
+    int maxSends;
+    WorkCounter next;         // Prochaine tâche de la frontière
+    WorkCounter pending;      // Unités de travail non terminées
+    Frontier *frontier;
+    int tasksLeft;            // La frontière n'est pas épuisée
+    StackSearch search;
+    int active;               // search contient une branche à explorer
+    int stealing;             // Demande de vol sans réponse
+    int victim;               // Prochain processus à voler
+    int finished;
+    int found;                // Processus 0 : une solution a été reçue
+    Board solution;
+} DistSearch;
+
+// Envoi synchrone non bloquant sur un emplacement libre de la réserve. Au
+// plus un vol en attente, une réponse par voleur, une fin par processus et
+// une solution : la réserve ne peut pas être pleine.
+static inline void distSend(DistSearch *d, int dest, int tag, const PackedGrid *payload) {
+    int k = 0;
+    for (;;) {
+        int done;
+        MPI_Test(&d->sendReq[k], &done, MPI_STATUS_IGNORE);
+        if (done) break;
+        k = (k + 1) % d->maxSends;
+    }
+    if (payload) d->sendBuf[k] = *payload;
+    MPI_Issend(payload ? &d->sendBuf[k] : NULL, payload ? (int)sizeof(PackedGrid) : 0, MPI_BYTE,
+               dest, tag, d->comm, &d->sendReq[k]);
+}
+
+static inline void distEnd(DistSearch *d) {
+    for (int r = 0; r < d->size; r++)
+        if (r != d->rank) distSend(d, r, TAG_DIST_END, NULL);
+    d->finished = 1;
+}
+
+static inline void distRecordSolution(DistSearch *d, const Board *b) {
+    if (d->rank == 0) {
+        if (!d->found) d->solution = *b;
+        d->found = 1;
+    } else {
+        Grid grid;
+        PackedGrid packed;
+        boardStore(b, &grid);
+        gridPack(&grid, &packed);
+        distSend(d, 0, TAG_DIST_SOLUTION, &packed);
+    }
+}
+
+// Détache la branche ouverte la moins profonde de la recherche en cours
+static inline int distDonate(DistSearch *d, PackedGrid *out) {
+    if (!d->active) return 0;
+    StackSearch *s = &d->search;
+    for (int level = 0; level < s->depth; level++) {
+        SearchFrame *f = &s->stack[level];
+        if (f->remaining == 0) continue;
+        // L'état du niveau s'obtient en annulant les poses plus récentes sur
+        // une copie (la trace d'annulation fait partie du Board)
+        Board branch = s->board;
+        boardUndo(&branch, f->mark);
+        boardAssign(&branch, f->cell, lowestDigit(f->remaining));
+        f->remaining &= f->remaining - 1;
+        Grid grid;
+        boardStore(&branch, &grid);
+        gridPack(&grid, out);
+        return 1;
+    }
+    return 0;
+}
+
+// Traite tous les messages arrivés
+static inline void distPoll(DistSearch *d) {
+    for (;;) {
+        int flag;
+        MPI_Status status;
+        MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, d->comm, &flag, &status);
+        if (!flag) return;
+        PackedGrid packed;
+        MPI_Recv(&packed, sizeof(packed), MPI_BYTE, status.MPI_SOURCE, status.MPI_TAG, d->comm,
+                 MPI_STATUS_IGNORE);
+        Grid grid;
+        Board b;
+        switch (status.MPI_TAG) {
+        case TAG_DIST_STEAL:
+            if (!d->finished && distDonate(d, &packed)) {
+                workCounterNext(&d->pending, 1);  // Avant l'envoi : jamais 0 en transit
+                distSend(d, status.MPI_SOURCE, TAG_DIST_WORK, &packed);
+            } else {
+                distSend(d, status.MPI_SOURCE, TAG_DIST_NOWORK, NULL);
+            }
+            break;
+        case TAG_DIST_WORK:
+            d->stealing = 0;
+            if (d->finished) break;
+            gridUnpack(&packed, &grid);
+            boardLoad(&b, &grid);
+            stackSearchInit(&d->search, &b);
+            d->active = 1;
+            break;
+        case TAG_DIST_NOWORK:
+            d->stealing = 0;
+            break;
+        case TAG_DIST_END:
+            d->finished = 1;
+            break;
+        case TAG_DIST_SOLUTION:
+            gridUnpack(&packed, &grid);
+            boardLoad(&b, &grid);
+            if (!d->found) d->solution = b;
+            d->found = 1;
+            break;
+        }
+    }
+}
+
+// Trouve du travail : tâche suivante de la frontière, sinon demande de vol
+static inline void distFindWork(DistSearch *d) {
+    if (d->tasksLeft) {
+        long i = workCounterNext(&d->next, 1);
+        if (i < frontierCount(d->frontier)) {
+            stackSearchInit(&d->search, frontierTask(d->frontier, (int)i));
+            d->active = 1;
+            return;
+        }
+        d->tasksLeft = 0;
+    }
+    if (d->size > 1 && !d->stealing) {
+        distSend(d, d->victim, TAG_DIST_STEAL, NULL);
+        d->stealing = 1;
+        do d->victim = (d->victim + 1) % d->size; while (d->victim == d->rank);
+    }
+}
+
+// Attend que tous les processus aient fini, en continuant à répondre. Un
+// processus n'entre dans la barrière qu'une fois tous ses envois reçus et sa
+// demande de vol servie : les messages encore à recevoir le seront avant que
+// la barrière ne se termine.
+static inline void distDrain(DistSearch *d) {
+    MPI_Request barrier = MPI_REQUEST_NULL;
+    int inBarrier = 0, done = 0;
+    while (!done) {
+        distPoll(d);
+        if (inBarrier) {
+            MPI_Test(&barrier, &done, MPI_STATUS_IGNORE);
+        } else if (!d->stealing) {
+            int sent;
+            MPI_Testall(d->maxSends, d->sendReq, &sent, MPI_STATUSES_IGNORE);
+            if (sent) {
+                MPI_Ibarrier(d->comm, &barrier);
+                inBarrier = 1;
+            }
+        }
+    }
+    // Réponses envoyées après l'entrée dans la barrière : déjà reçues
+    MPI_Waitall(d->maxSends, d->sendReq, MPI_STATUSES_IGNORE);
+}
+
+// Résout root (déjà propagé) avec tous les processus de comm (collectif).
+// Renvoie 1 sur tous les processus si une solution existe ; elle est alors
+// copiée dans solution sur tous les processus. Renvoie -1 sur tous les
+// processus si la mémoire manque sur l'un d'eux.
+static inline int distSolve(const Board *root, MPI_Comm comm, int maxDepth, Board *solution) {
+    DistSearch d;
+    memset(&d, 0, sizeof(d));
+    MPI_Comm_dup(comm, &d.comm);
+    MPI_Comm_rank(d.comm, &d.rank);
+    MPI_Comm_size(d.comm, &d.size);
+
+    // Même frontière sur tous les processus (calcul déterministe)
+    Frontier frontier;
+    frontierInit(&frontier);
+    int ok = frontierExpand(&frontier, root, maxDepth, DIST_TASKS_PER_RANK * d.size);
+    d.maxSends = 2 * d.size + 2;
+    d.sendReq = malloc(d.maxSends * sizeof(MPI_Request));
+    d.sendBuf = malloc(d.maxSends * sizeof(PackedGrid));
+    ok = ok && d.sendReq && d.sendBuf;
+    // Les allocations ne réussissent pas forcément partout : tous les
+    // processus renoncent ensemble plutôt que de laisser les autres bloqués
+    // dans les appels collectifs qui suivent
+    MPI_Allreduce(MPI_IN_PLACE, &ok, 1, MPI_INT, MPI_MIN, d.comm);
+    int result = -1;
+    if (!ok) {
+        result = -1;
+    } else if (frontier.solved) {
+        *solution = frontier.solution;
+        result = 1;
+    } else if (frontierCount(&frontier) == 0) {
+        result = 0;
+    }
+    if (result >= 0 || !ok) {
+        free(d.sendReq);
+        free(d.sendBuf);
+        frontierFree(&frontier);
+        MPI_Comm_free(&d.comm);
+        return result;
+    }
+
+    d.frontier = &frontier;
+    d.tasksLeft = 1;
+    d.victim = (d.rank + 1) % d.size;
+    for (int k = 0; k < d.maxSends; k++) d.sendReq[k] = MPI_REQUEST_NULL;
+    workCounterCreate(&d.next, d.comm);
+    workCounterCreate(&d.pending, d.comm);
+    if (d.rank == 0) workCounterNext(&d.pending, frontierCount(&frontier));
+    MPI_Barrier(d.comm);  // Unités comptées avant la première tâche terminée
+
+    // Temps de calcul : les tranches de recherche ; le reste (messages, vol,
+    // barrière et diffusion finales) est compté comme communication
+    STAT_COMM_BEGIN(loopStart);
+    while (!d.finished) {
+        distPoll(&d);
+        if (d.finished) break;
+        if (!d.active) {
+            distFindWork(&d);
+            continue;
+        }
+        SearchControl ctl;
+        searchInit(&ctl, NULL);
+        ctl.maxNodes = DIST_SLICE_NODES;
+        STAT_CLOCK(sliceStart);
+        SearchStatus status = stackSearchRun(&d.search, &ctl);
+        STAT_ELAPSED(busy, sliceStart);
+        if (status == SEARCH_SOLVED) {
+            distRecordSolution(&d, &d.search.board);
+            distEnd(&d);
+        } else if (status == SEARCH_EXHAUSTED) {
+            d.active = 0;
+            if (workCounterNext(&d.pending, -1) == 1) distEnd(&d);  // Dernière unité
+        }
+    }
+    distDrain(&d);
+
+    // Le processus 0 connaît le résultat : diffusion à tous
+    Grid grid;
+    if (d.rank == 0 && d.found) boardStore(&d.solution, &grid);
+    MPI_Bcast(&d.found, 1, MPI_INT, 0, d.comm);
+    if (d.found) {
+        MPI_Bcast(grid.cells, NN, MPI_BYTE, 0, d.comm);
+        boardLoad(solution, &grid);
+    }
+    STAT_COMM_END(loopStart);
+
+    workCounterFree(&d.next);
+    workCounterFree(&d.pending);
+    free(d.sendReq);
+    free(d.sendBuf);
+    frontierFree(&frontier);
+    MPI_Comm_free(&d.comm);
+    return d.found;
+}
+
+#endif
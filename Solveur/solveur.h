@@ -0,0 +1,40 @@
+#ifndef SUDOKU_SOLVEUR_H
+#define SUDOKU_SOLVEUR_H
+
+// Interface commune aux moteurs de résolution, choisis à l'exécution.
+
+#include <string.h>
+#include "sudoku_core.h"
+#include "dlx.h"
+
+typedef enum {
+    BACKEND_BACKTRACK,        // Backtracking MRV + propagation (sudoku_core.h)
+    BACKEND_DLX               // Algorithm X / dancing links (dlx.h)
+} SolverBackend;
+
+static inline const char *backendName(SolverBackend backend) {
+    return backend == BACKEND_DLX ? "dlx" : "backtrack";
+}
+
+// Lit le nom d'un moteur ("backtrack" ou "dlx"). Renvoie 0 s'il est inconnu.
+static inline int parseBackend(const char *name, SolverBackend *backend) {
+    if (strcmp(name, "backtrack") == 0) *backend = BACKEND_BACKTRACK;
+    else if (strcmp(name, "dlx") == 0) *backend = BACKEND_DLX;
+    else return 0;
+    return 1;
+}
+
+// Complète le Board avec le moteur choisi (ctl peut être NULL)
+static inline int boardSolveWith(Board *b, SolverBackend backend, SearchControl *ctl) {
+    return backend == BACKEND_DLX ? boardSolveDlx(b, ctl) : boardSolvePropagate(b, ctl);
+}
+
+static inline int solveGridWith(Grid *grid, SolverBackend backend) {
+    Board b;
+    if (!boardLoad(&b, grid)) return 0;
+    if (!boardSolveWith(&b, backend, NULL)) return 0;
+    boardStore(&b, grid);
+    return 1;
+}
+
+#endif
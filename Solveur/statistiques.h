@@ -0,0 +1,179 @@
+#ifndef SUDOKU_STATISTIQUES_H
+#define SUDOKU_STATISTIQUES_H
+
+// Compteurs de la recherche, pour savoir d'où vient un mauvais speedup :
+// déséquilibre de charge, recherche spéculative perdue ou communications.
+//
+// Ils ne sont compilés qu'avec -DSEARCH_STATS. Sans ce drapeau, les macros
+// STAT_* ne produisent aucun code et STATS_ENABLED vaut 0 : les rapports
+// écrits sous if (STATS_ENABLED) disparaissent aussi.
+//
+// Chaque thread incrémente sa propre copie (_Thread_local) : ni atomique ni
+// ligne de cache partagée dans le chemin critique. Les programmes relèvent
+// les compteurs de chaque thread après une phase parallèle (statsGather),
+// dans un tableau de SearchStats alignés sur les lignes de cache.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define STATS_CACHE_LINE 64
+
+typedef struct {
+    unsigned long nodes;          // Nœuds visités
+    unsigned long backtracks;     // Impasses : contradiction ou candidats épuisés
+    unsigned long propagations;   // Cases posées par les singletons
+    int depth;                    // Profondeur de choix courante (recherche récursive)
+    int maxDepth;                 // Profondeur de choix maximale atteinte
+    double busy;                  // Secondes de calcul (chemins parallèles)
+    double steal;                 // Secondes passées à chercher du travail
+    double idle;                  // Secondes d'attente (voir statsSetIdle)
+    double comm;                  // Secondes de communication MPI
+} __attribute__((aligned(STATS_CACHE_LINE))) SearchStats;
+
+// Tableau de compteurs par unité (thread ou processus), une ligne de cache
+// chacun, à libérer avec free
+static inline SearchStats *statsAlloc(int count) {
+    SearchStats *s = aligned_alloc(STATS_CACHE_LINE, count * sizeof(SearchStats));
+    if (s) memset(s, 0, count * sizeof(SearchStats));
+    return s;
+}
+
+// Horloge monotone en secondes (aussi utilisée pour les échéances de recherche)
+static inline double monotonicSeconds(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+#ifdef SEARCH_STATS
+#define STATS_ENABLED 1
+static _Thread_local SearchStats searchStats;
+#define STAT_ADD(field, n) (searchStats.field += (n))
+#define STAT_DEPTH(d) \
+    do { if ((d) > searchStats.maxDepth) searchStats.maxDepth = (d); } while (0)
+#define STAT_PUSH() \
+    do { if (++searchStats.depth > searchStats.maxDepth) searchStats.maxDepth = searchStats.depth; } while (0)
+#define STAT_POP() (searchStats.depth--)
+// STAT_CLOCK(t) déclare le départ t ; STAT_ELAPSED ajoute le temps écoulé
+#define STAT_CLOCK(t) double t = monotonicSeconds()
+#define STAT_ELAPSED(field, t) (searchStats.field += monotonicSeconds() - (t))
+// Entre STAT_COMM_BEGIN(t) et STAT_COMM_END(t), tout le temps qui n'est pas
+// compté comme calcul (busy) est compté comme communication
+#define STAT_COMM_BEGIN(t) STAT_CLOCK(t); STAT_ADD(comm, searchStats.busy)
+#define STAT_COMM_END(t) STAT_ADD(comm, monotonicSeconds() - (t) - searchStats.busy)
+#else
+#define STATS_ENABLED 0
+#define STAT_ADD(field, n) ((void)0)
+#define STAT_DEPTH(d) ((void)0)
+#define STAT_PUSH() ((void)0)
+#define STAT_POP() ((void)0)
+#define STAT_CLOCK(t) ((void)0)
+#define STAT_ELAPSED(field, t) ((void)0)
+#define STAT_COMM_BEGIN(t) ((void)0)
+#define STAT_COMM_END(t) ((void)0)
+#endif
+
+// Ajoute les compteurs de s à total (profondeur : maximum)
+static inline void statsMerge(SearchStats *total, const SearchStats *s) {
+    total->nodes += s->nodes;
+    total->backtracks += s->backtracks;
+    total->propagations += s->propagations;
+    if (s->maxDepth > total->maxDepth) total->maxDepth = s->maxDepth;
+    total->busy += s->busy;
+    total->steal += s->steal;
+    total->idle += s->idle;
+    total->comm += s->comm;
+}
+
+// Ajoute les compteurs du thread appelant à *out et les remet à zéro
+static inline void statsTake(SearchStats *out) {
+#ifdef SEARCH_STATS
+    int depth = searchStats.depth;
+    statsMerge(out, &searchStats);
+    memset(&searchStats, 0, sizeof(searchStats));
+    searchStats.depth = depth;
+#else
+    (void)out;
+#endif
+}
+
+// Attente d'une unité sur une phase de durée wall : ce qui n'est ni calcul,
+// ni recherche de travail, ni communication
+static inline void statsSetIdle(SearchStats *s, double wall) {
+    double idle = wall - s->busy - s->steal - s->comm;
+    s->idle = idle > 0 ? idle : 0;
+}
+
+static inline void statsPrint(const char *label, const SearchStats *s) {
+    printf("%-14s nœuds %10lu  impasses %10lu  propagations %11lu  prof. max %3d  "
+           "calcul %.4f s  vol %.4f s  attente %.4f s  comm %.4f s\n",
+           label, s->nodes, s->backtracks, s->propagations, s->maxDepth, s->busy, s->steal, s->idle,
+           s->comm);
+}
+
+#ifdef _OPENMP
+#include <omp.h>
+
+// Relève les compteurs des numThreads threads de l'équipe suivante dans
+// perThread[] (remis à zéro au préalable). Les threads d'OpenMP étant
+// conservés d'une région parallèle à l'autre, ceux de la phase précédente se
+// retrouvent sous le même numéro.
+static inline void statsGather(SearchStats *perThread, int numThreads) {
+    memset(perThread, 0, numThreads * sizeof(SearchStats));
+    #pragma omp parallel num_threads(numThreads)
+    statsTake(&perThread[omp_get_thread_num()]);
+}
+
+// Affiche les compteurs de chaque thread et leur total pour une phase de
+// durée wall
+static inline void statsReportThreads(const char *phase, SearchStats *perThread, int numThreads,
+                                      double wall) {
+    SearchStats total;
+    memset(&total, 0, sizeof(total));
+    printf("Statistiques de recherche (%s) :\n", phase);
+    for (int t = 0; t < numThreads; t++) {
+        char label[32];
+        snprintf(label, sizeof(label), "  thread %d", t);
+        statsSetIdle(&perThread[t], wall);
+        statsPrint(label, &perThread[t]);
+        statsMerge(&total, &perThread[t]);
+    }
+    statsPrint("  total", &total);
+}
+#endif
+
+// Programmes MPI (mpi.h inclus avant les en-têtes du solveur)
+#ifdef MPI_VERSION
+// Rassemble les compteurs de chaque processus sur le processus 0, qui les
+// affiche (collectif). local->busy et local->comm donnent le temps de calcul
+// et de communication du processus ; son attente est l'écart avec le plus
+// lent.
+static inline void statsReportRanks(SearchStats *local, MPI_Comm comm) {
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    double mine = local->busy + local->comm, wall;
+    MPI_Allreduce(&mine, &wall, 1, MPI_DOUBLE, MPI_MAX, comm);
+    local->idle = wall - mine;
+    SearchStats *all = NULL;
+    if (rank == 0 && !(all = statsAlloc(size))) MPI_Abort(comm, 1);
+    MPI_Gather(local, sizeof(SearchStats), MPI_BYTE, all, sizeof(SearchStats), MPI_BYTE, 0, comm);
+    if (rank == 0) {
+        SearchStats total;
+        memset(&total, 0, sizeof(total));
+        printf("Statistiques de recherche par processus :\n");
+        for (int r = 0; r < size; r++) {
+            char label[32];
+            snprintf(label, sizeof(label), "  processus %d", r);
+            statsPrint(label, &all[r]);
+            statsMerge(&total, &all[r]);
+        }
+        statsPrint("  total", &total);
+        free(all);
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,465 @@
+#ifndef SUDOKU_CORE_H
+#define SUDOKU_CORE_H
+
+// Noyau de résolution partagé par tous les solveurs.
+//
+// Au lieu de rescanner la ligne, la colonne et le bloc à chaque essai
+// (isSafe), on maintient pour chaque ligne, colonne et bloc un masque de
+// N bits des chiffres déjà posés. Les candidats d'une case s'obtiennent
+// alors en un seul AND/NOT, et on les parcourt avec count-trailing-zeros.
+
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "grille.h"
+#include "statistiques.h"
+
+// Types les plus étroits pour la taille compilée : masques de 16 bits et
+// index de case sur un octet en 9×9
+#if N <= 16
+typedef uint16_t Mask;        // Bit d-1 à 1 <=> chiffre d présent / candidat
+#else
+typedef uint32_t Mask;
+#endif
+#if NN < 256
+typedef uint8_t CellIndex;    // Index de case ou nombre de cases (0..NN)
+#else
+typedef uint16_t CellIndex;
+#endif
+
+#define ALL_DIGITS ((Mask)((1u << N) - 1))
+
+typedef struct {
+    uint8_t cells[NN];        // 0 = case vide, 1..N sinon (ordre ligne par ligne)
+    Mask row[N];
+    Mask col[N];
+    Mask box[N];
+    // Suivi pour l'ordre MRV (maintenu par boardAssign / boardUnassign)
+    uint8_t count[NN];        // Nombre de candidats de chaque case vide
+    CellIndex empty[NN];      // Cases vides dans [0, numEmpty), puis pile des
+                              // cases posées par boardAssign (la plus récente
+                              // en empty[numEmpty]) : c'est la trace d'annulation
+    CellIndex pos[NN];        // Position de chaque case dans empty[]
+    int numEmpty;
+} Board;
+
+// Stratégie de résolution
+typedef enum {
+    MODE_ROW_MAJOR,           // Cases parcourues ligne par ligne
+    MODE_MRV,                 // Case ayant le moins de candidats d'abord
+    MODE_PROPAGATE            // MRV + singletons nus / cachés à chaque nœud
+} SolveMode;
+
+// Contrôle d'une recherche : arrêt coopératif demandé par un autre thread,
+// budget de nœuds épuisé ou échéance dépassée. Le drapeau partagé et
+// l'horloge ne sont lus que tous les STOP_POLL_INTERVAL nœuds ; une fois
+// l'arrêt constaté, toutes les fonctions de recherche renvoient 0 sans
+// explorer davantage (stopped permet de distinguer un arrêt d'une absence de
+// solution).
+#define STOP_POLL_INTERVAL 64
+
+typedef struct {
+    atomic_int *stop;         // Drapeau d'arrêt partagé (NULL : jamais d'arrêt)
+    int stopped;              // L'arrêt a été constaté
+    unsigned long nodes;      // Nœuds visités
+    unsigned long maxNodes;   // Budget de nœuds (0 : illimité)
+    double deadline;          // Échéance, horloge monotonicSeconds (0 : aucune)
+} SearchControl;
+
+static inline void searchInit(SearchControl *ctl, atomic_int *stop) {
+    ctl->stop = stop;
+    ctl->stopped = 0;
+    ctl->nodes = 0;
+    ctl->maxNodes = 0;
+    ctl->deadline = 0.0;
+}
+
+// Arrête la recherche après seconds secondes (0 : pas d'échéance)
+static inline void searchSetTimeLimit(SearchControl *ctl, double seconds) {
+    ctl->deadline = seconds > 0 ? monotonicSeconds() + seconds : 0.0;
+}
+
+// À appeler à chaque nœud ; ctl peut être NULL
+static inline int searchShouldStop(SearchControl *ctl) {
+    if (ctl == NULL) return 0;
+    if (ctl->stopped) return 1;
+    if (++ctl->nodes % STOP_POLL_INTERVAL == 0) {
+        if (ctl->stop && atomic_load_explicit(ctl->stop, memory_order_relaxed))
+            ctl->stopped = 1;
+        if (ctl->deadline > 0 && monotonicSeconds() > ctl->deadline)
+            ctl->stopped = 1;
+    }
+    if (ctl->maxNodes && ctl->nodes > ctl->maxNodes)
+        ctl->stopped = 1;
+    return ctl->stopped;
+}
+
+static inline int cellRow(int idx) { return idx / N; }
+static inline int cellCol(int idx) { return idx % N; }
+static inline int cellBox(int idx) {
+    return (cellRow(idx) / BOX) * BOX + cellCol(idx) / BOX;
+}
+
+static inline Mask digitBit(int d) { return (Mask)(1u << (d - 1)); }
+
+// Plus petit chiffre présent dans le masque (le masque doit être non nul)
+static inline int lowestDigit(Mask m) { return __builtin_ctz(m) + 1; }
+
+static inline int countDigits(Mask m) { return __builtin_popcount(m); }
+
+// Chiffres encore autorisés pour la case idx
+static inline Mask boardCandidates(const Board *b, int idx) {
+    return ALL_DIGITS & ~(b->row[cellRow(idx)] | b->col[cellCol(idx)] | b->box[cellBox(idx)]);
+}
+
+static inline void boardPlace(Board *b, int idx, int d) {
+    Mask bit = digitBit(d);
+    b->cells[idx] = d;
+    b->row[cellRow(idx)] |= bit;
+    b->col[cellCol(idx)] |= bit;
+    b->box[cellBox(idx)] |= bit;
+}
+
+static inline void boardUnplace(Board *b, int idx) {
+    Mask keep = (Mask)~digitBit(b->cells[idx]);
+    b->cells[idx] = 0;
+    b->row[cellRow(idx)] &= keep;
+    b->col[cellCol(idx)] &= keep;
+    b->box[cellBox(idx)] &= keep;
+}
+
+// Ajuste le compteur du voisin p si le chiffre bit fait partie de ses candidats
+static inline void boardAdjustPeer(Board *b, int p, Mask bit, int delta) {
+    if (b->cells[p] == 0 && (boardCandidates(b, p) & bit))
+        b->count[p] += delta;
+}
+
+// Applique boardAdjustPeer à toutes les cases de la même ligne, colonne ou bloc
+static inline void boardAdjustPeers(Board *b, int idx, Mask bit, int delta) {
+    int r = cellRow(idx), c = cellCol(idx);
+    int br = r - r % BOX, bc = c - c % BOX;
+    for (int k = 0; k < N; k++) {
+        boardAdjustPeer(b, r * N + k, bit, delta);
+        boardAdjustPeer(b, k * N + c, bit, delta);
+    }
+    for (int i = br; i < br + BOX; i++)
+        for (int j = bc; j < bc + BOX; j++)
+            if (i != r && j != c)
+                boardAdjustPeer(b, i * N + j, bit, delta);
+}
+
+// Comme boardPlace, mais met aussi à jour les compteurs de candidats des
+// voisins et la liste des cases vides (utilisé par le parcours MRV).
+static inline void boardAssign(Board *b, int idx, int d) {
+    Mask bit = digitBit(d);
+    b->cells[idx] = d;
+    boardAdjustPeers(b, idx, bit, -1);
+    b->row[cellRow(idx)] |= bit;
+    b->col[cellCol(idx)] |= bit;
+    b->box[cellBox(idx)] |= bit;
+
+    // Retrait de la liste par échange avec la dernière case
+    int p = b->pos[idx], last = b->empty[--b->numEmpty];
+    b->empty[p] = last;
+    b->pos[last] = p;
+    b->empty[b->numEmpty] = idx;
+}
+
+// Annule le dernier boardAssign (les retraits doivent se faire dans l'ordre
+// inverse des poses). La case posée la plus récente est empty[numEmpty].
+static inline void boardUnassign(Board *b, int idx) {
+    Mask bit = digitBit(b->cells[idx]);
+    boardUnplace(b, idx);
+    boardAdjustPeers(b, idx, bit, +1);
+    b->count[idx] = countDigits(boardCandidates(b, idx));
+
+    int p = b->pos[idx], moved = b->empty[p];
+    b->empty[b->numEmpty] = moved;
+    b->pos[moved] = b->numEmpty++;
+    b->empty[p] = idx;
+}
+
+// Construit l'état à partir d'une grille. Renvoie 0 si une valeur est hors
+// bornes ou si deux indices se contredisent.
+static inline int boardLoad(Board *b, const Grid *grid) {
+    memset(b, 0, sizeof(*b));
+    for (int idx = 0; idx < NN; idx++) {
+        int d = grid->cells[idx];
+        if (d == 0) continue;
+        if (d > N) return 0;
+        if (!(boardCandidates(b, idx) & digitBit(d))) return 0;
+        boardPlace(b, idx, d);
+    }
+    for (int idx = 0; idx < NN; idx++) {
+        if (b->cells[idx] != 0) continue;
+        b->count[idx] = countDigits(boardCandidates(b, idx));
+        b->pos[idx] = b->numEmpty;
+        b->empty[b->numEmpty++] = idx;
+    }
+    return 1;
+}
+
+static inline void boardStore(const Board *b, Grid *grid) {
+    memcpy(grid->cells, b->cells, NN);
+}
+
+// Première case vide à partir de idx (NN si aucune)
+static inline int boardNextEmpty(const Board *b, int idx) {
+    while (idx < NN && b->cells[idx] != 0) idx++;
+    return idx;
+}
+
+// Backtracking ligne par ligne à partir de la case idx.
+// Utilise boardPlace : le suivi MRV n'est pas maintenu.
+static inline int boardSolveFrom(Board *b, int idx, SearchControl *ctl) {
+    if (searchShouldStop(ctl)) return 0;
+    STAT_ADD(nodes, 1);
+    idx = boardNextEmpty(b, idx);
+    if (idx == NN) return 1;
+
+    Mask cand = boardCandidates(b, idx);
+    while (cand) {
+        int d = lowestDigit(cand);
+        cand &= cand - 1;
+        boardPlace(b, idx, d);
+        STAT_PUSH();
+        int solved = boardSolveFrom(b, idx + 1, ctl);
+        STAT_POP();
+        if (solved) return 1;
+        boardUnplace(b, idx);
+    }
+    STAT_ADD(backtracks, 1);
+    return 0;
+}
+
+// Case vide ayant le moins de candidats (-1 s'il n'y en a plus)
+static inline int boardPickMRV(const Board *b) {
+    int best = -1, bestCount = N + 1;
+    for (int i = 0; i < b->numEmpty; i++) {
+        int idx = b->empty[i];
+        if (b->count[idx] < bestCount) {
+            best = idx;
+            bestCount = b->count[idx];
+            if (bestCount <= 1) break;  // Impossible de faire mieux
+        }
+    }
+    return best;
+}
+
+// Backtracking en choisissant à chaque étape la case la plus contrainte
+static inline int boardSolveMRV(Board *b, SearchControl *ctl) {
+    if (searchShouldStop(ctl)) return 0;
+    STAT_ADD(nodes, 1);
+    if (b->numEmpty == 0) return 1;
+    int idx = boardPickMRV(b);
+
+    Mask cand = boardCandidates(b, idx);
+    while (cand) {
+        int d = lowestDigit(cand);
+        cand &= cand - 1;
+        boardAssign(b, idx, d);
+        STAT_PUSH();
+        int solved = boardSolveMRV(b, ctl);
+        STAT_POP();
+        if (solved) return 1;
+        boardUnassign(b, idx);
+    }
+    STAT_ADD(backtracks, 1);
+    return 0;
+}
+
+// Annule toutes les poses faites depuis que numEmpty valait mark
+static inline void boardUndo(Board *b, int mark) {
+    while (b->numEmpty < mark)
+        boardUnassign(b, b->empty[b->numEmpty]);
+}
+
+// Index de la k-ième case de l'unité u (N lignes, puis N colonnes, puis N blocs)
+static inline int unitCell(int u, int k) {
+    if (u < N) return u * N + k;
+    if (u < 2 * N) return k * N + (u - N);
+    u -= 2 * N;
+    return ((u / BOX) * BOX + k / BOX) * N + (u % BOX) * BOX + k % BOX;
+}
+
+// Chiffres déjà posés dans l'unité u
+static inline Mask unitPlaced(const Board *b, int u) {
+    if (u < N) return b->row[u];
+    if (u < 2 * N) return b->col[u - N];
+    return b->box[u - 2 * N];
+}
+
+// Pose les singletons nus (case à un seul candidat) jusqu'à point fixe.
+// Renvoie 0 si une case n'a plus aucun candidat, -1 si rien n'a été posé.
+static inline int boardNakedSingles(Board *b) {
+    int changed = -1;
+    for (int i = 0; i < b->numEmpty; ) {
+        int idx = b->empty[i];
+        if (b->count[idx] == 0) return 0;
+        if (b->count[idx] == 1) {
+            // La dernière case vide prend la place i : on ne fait pas i++
+            boardAssign(b, idx, lowestDigit(boardCandidates(b, idx)));
+            STAT_ADD(propagations, 1);
+            changed = 1;
+        } else {
+            i++;
+        }
+    }
+    return changed;
+}
+
+// Pose les singletons cachés (chiffre n'ayant qu'une place dans une unité).
+// Renvoie 0 si un chiffre n'a plus de place dans une unité, -1 si rien n'a
+// été posé.
+static inline int boardHiddenSingles(Board *b) {
+    int changed = -1;
+    for (int u = 0; u < 3 * N; u++) {
+        Mask once = 0, twice = 0;
+        for (int k = 0; k < N; k++) {
+            int idx = unitCell(u, k);
+            if (b->cells[idx] != 0) continue;
+            Mask c = boardCandidates(b, idx);
+            twice |= once & c;
+            once |= c;
+        }
+        if ((once | unitPlaced(b, u)) != ALL_DIGITS) return 0;
+
+        for (Mask singles = once & ~twice; singles; singles &= singles - 1) {
+            Mask bit = singles & -singles;
+            int k = 0;
+            while (k < N && (b->cells[unitCell(u, k)] != 0 ||
+                             !(boardCandidates(b, unitCell(u, k)) & bit)))
+                k++;
+            if (k == N) return 0;  // Sa seule place a été prise par un autre singleton
+            boardAssign(b, unitCell(u, k), lowestDigit(bit));
+            STAT_ADD(propagations, 1);
+            changed = 1;
+        }
+    }
+    return changed;
+}
+
+// Propagation jusqu'à point fixe. Renvoie 0 en cas de contradiction ; les
+// poses effectuées restent alors à annuler par boardUndo.
+static inline int boardPropagate(Board *b) {
+    for (;;) {
+        int naked = boardNakedSingles(b);
+        if (naked == 0) return 0;
+        int hidden = boardHiddenSingles(b);
+        if (hidden == 0) return 0;
+        if (naked < 0 && hidden < 0) return 1;
+    }
+}
+
+// Recherche itérative (MRV + propagation) avec une pile explicite.
+//
+// Chaque niveau de la pile retient la case choisie, les candidats qui restent
+// à essayer et la marque d'annulation d'avant le choix : il n'y a ni appel
+// récursif ni cadre de pile C par case. Tout l'état de la recherche tient
+// dans StackSearch, qui peut donc être interrompu (arrêt, budget ou échéance
+// du SearchControl) puis repris plus tard par un nouvel appel, éventuellement
+// sur un autre thread après copie. StackSearch ne contient aucun pointeur :
+// sa copie brute (ou son envoi en MPI_BYTE à un processus du même programme)
+// suffit à exporter l'état de la recherche ; frontierFromSearch (frontiere.h)
+// le découpe en branches indépendantes.
+typedef enum {
+    SEARCH_STOPPED = -1,      // Interrompue : stackSearchRun peut reprendre
+    SEARCH_EXHAUSTED = 0,     // Plus de solution ; le Board est restauré
+    SEARCH_SOLVED = 1         // board contient une solution
+} SearchStatus;
+
+typedef struct {
+    CellIndex cell;           // Case du choix
+    CellIndex mark;           // numEmpty avant le choix (pour boardUndo)
+    Mask remaining;           // Candidats restant à essayer
+} SearchFrame;
+
+typedef struct {
+    Board board;
+    SearchFrame stack[NN];
+    int depth;                // Nombre de niveaux dans stack
+    int rootMark;             // numEmpty au départ
+    int descend;              // 1 : le nœud courant reste à propager
+} StackSearch;
+
+static inline void stackSearchInit(StackSearch *s, const Board *b) {
+    s->board = *b;
+    s->depth = 0;
+    s->rootMark = b->numEmpty;
+    s->descend = 1;
+}
+
+// Poursuit la recherche. Après SEARCH_SOLVED, un nouvel appel passe à la
+// solution suivante.
+static inline SearchStatus stackSearchRun(StackSearch *s, SearchControl *ctl) {
+    Board *b = &s->board;
+    for (;;) {
+        if (s->descend) {
+            if (searchShouldStop(ctl)) return SEARCH_STOPPED;
+            STAT_ADD(nodes, 1);
+            s->descend = 0;
+            if (boardPropagate(b)) {
+                if (b->numEmpty == 0) return SEARCH_SOLVED;
+                SearchFrame *f = &s->stack[s->depth++];
+                f->cell = boardPickMRV(b);
+                f->mark = b->numEmpty;
+                f->remaining = boardCandidates(b, f->cell);
+                STAT_DEPTH(s->depth);
+            } else {
+                STAT_ADD(backtracks, 1);
+            }
+        }
+
+        // Candidat suivant du niveau le plus profond, en annulant la branche
+        // précédente (choix et propagation)
+        if (s->depth == 0) {
+            boardUndo(b, s->rootMark);
+            return SEARCH_EXHAUSTED;
+        }
+        SearchFrame *f = &s->stack[s->depth - 1];
+        boardUndo(b, f->mark);
+        if (f->remaining == 0) {
+            STAT_ADD(backtracks, 1);
+            s->depth--;
+            continue;
+        }
+        int d = lowestDigit(f->remaining);
+        f->remaining &= f->remaining - 1;
+        boardAssign(b, f->cell, d);
+        s->descend = 1;
+    }
+}
+
+// Backtracking MRV avec propagation à chaque nœud (pile explicite). En cas
+// d'échec, le Board est laissé tel qu'à l'appel.
+static inline int boardSolvePropagate(Board *b, SearchControl *ctl) {
+    StackSearch s;
+    stackSearchInit(&s, b);
+    if (stackSearchRun(&s, ctl) != SEARCH_SOLVED) return 0;
+    *b = s.board;
+    return 1;
+}
+
+static inline int boardSolve(Board *b, SolveMode mode, SearchControl *ctl) {
+    switch (mode) {
+    case MODE_ROW_MAJOR: return boardSolveFrom(b, 0, ctl);
+    case MODE_MRV:       return boardSolveMRV(b, ctl);
+    default:             return boardSolvePropagate(b, ctl);
+    }
+}
+
+// Résout la grille en place avec la stratégie donnée. Renvoie 1 si une
+// solution a été trouvée.
+static inline int solveGridMode(Grid *grid, SolveMode mode) {
+    Board b;
+    if (!boardLoad(&b, grid)) return 0;
+    if (!boardSolve(&b, mode, NULL)) return 0;
+    boardStore(&b, grid);
+    return 1;
+}
+
+static inline int solveGrid(Grid *grid) {
+    return solveGridMode(grid, MODE_PROPAGATE);
+}
+
+#endif
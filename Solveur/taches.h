@@ -0,0 +1,126 @@
+#ifndef SUDOKU_TACHES_H
+#define SUDOKU_TACHES_H
+
+// Parallélisme imbriqué avec les tâches OpenMP.
+//
+// Chaque grille d'un lot est une tâche. Une grille est d'abord attaquée
+// séquentiellement avec un budget de nœuds : la plupart des grilles se
+// résolvent ainsi sans surcoût. Si le budget est épuisé, la grille est jugée
+// difficile : ce qu'il reste de sa recherche est découpé (frontiere.h), sans
+// refaire les nœuds déjà explorés, et ses sous-problèmes sont
+// lancés comme tâches dans la même équipe de threads. Les threads qui ont fini
+// leurs grilles prennent donc ces sous-tâches au lieu d'attendre la grille la
+// plus longue, sans région parallèle imbriquée.
+//
+// À inclure uniquement dans les programmes compilés avec -fopenmp.
+
+#include <omp.h>
+#include "solveur.h"
+#include "frontiere.h"
+
+#define HARD_GRID_NODES 4096   // Budget avant découpage d'une grille
+
+typedef struct {
+    SolverBackend backend;
+    atomic_int found;         // Drapeau d'arrêt des sous-tâches de la grille
+    Board solution;
+} GridTask;
+
+// Sous-tâche : résout une tâche de la frontière sauf si une sœur a déjà trouvé
+static inline void taskSolveBranch(GridTask *t, const Board *branch) {
+    if (atomic_load_explicit(&t->found, memory_order_relaxed)) return;
+    Board local = *branch;
+    SearchControl ctl;
+    searchInit(&ctl, &t->found);
+    STAT_CLOCK(busyStart);
+    int solved = boardSolveWith(&local, t->backend, &ctl);
+    STAT_ELAPSED(busy, busyStart);
+    if (!solved) return;
+    #pragma omp critical(task_solution)
+    {
+        if (!atomic_load(&t->found)) {
+            t->solution = local;
+            atomic_store(&t->found, 1);
+        }
+    }
+}
+
+// Découpe board (déjà propagé) en tâches : les branches laissées ouvertes par
+// l'essai séquentiel interrompu search (NULL : depuis la racine), développées
+// jusqu'à target tâches. Renvoie 0 si la mémoire manque.
+static inline int taskSplit(Frontier *frontier, const Board *board, const StackSearch *search,
+                            int maxDepth, int target) {
+    if (!search) return frontierExpand(frontier, board, maxDepth, target);
+    return frontierFromSearch(frontier, search) && frontierRefine(frontier, maxDepth, target);
+}
+
+// Résout board (déjà propagé) depuis une tâche ou une région parallèle.
+// Renvoie 1 et remplit solution si une solution existe.
+static inline int taskSolveBoard(const Board *board, SolverBackend backend, int maxDepth,
+                                 int targetTasks, Board *solution) {
+    // Essai séquentiel avec budget. Avec le backtracking, la recherche est une
+    // StackSearch : si le budget est épuisé, ses branches encore ouvertes sont
+    // découpées au lieu de recommencer depuis la racine.
+    // (le temps de calcul des sous-tâches est compté par taskSolveBranch, pas
+    // ici : le thread en exécute d'autres pendant l'attente du taskgroup)
+    SearchControl ctl;
+    searchInit(&ctl, NULL);
+    ctl.maxNodes = HARD_GRID_NODES;
+    StackSearch search, *resume = NULL;
+    Board attempt = *board;
+    STAT_CLOCK(busyStart);
+    int solved;
+    if (backend == BACKEND_BACKTRACK) {
+        stackSearchInit(&search, board);
+        SearchStatus status = stackSearchRun(&search, &ctl);
+        solved = status == SEARCH_SOLVED;
+        if (solved) attempt = search.board;
+        else if (status == SEARCH_STOPPED) resume = &search;
+    } else {
+        solved = boardSolveWith(&attempt, backend, &ctl);
+    }
+    STAT_ELAPSED(busy, busyStart);
+    if (solved) {
+        *solution = attempt;
+        return 1;
+    }
+    if (!ctl.stopped) return 0;  // Espace épuisé : pas de solution
+
+    // Grille difficile : sous-tâches dans l'équipe courante
+    int target = targetTasks > 0 ? targetTasks
+                                 : FRONTIER_TASKS_PER_THREAD * omp_get_num_threads();
+    Frontier frontier;
+    frontierInit(&frontier);
+    if (!taskSplit(&frontier, board, resume, maxDepth, target)) {
+        // Mémoire insuffisante : résolution sans découpage
+        frontierFree(&frontier);
+        attempt = *board;
+        if (!boardSolveWith(&attempt, backend, NULL)) return 0;
+        *solution = attempt;
+        return 1;
+    }
+    if (frontier.solved) {
+        *solution = frontier.solution;
+        frontierFree(&frontier);
+        return 1;
+    }
+
+    GridTask t;
+    t.backend = backend;
+    atomic_init(&t.found, 0);
+    // taskgroup attend les sous-tâches ; le thread courant en exécute
+    // lui-même pendant l'attente
+    #pragma omp taskgroup
+    {
+        for (int i = 0; i < frontierCount(&frontier); i++) {
+            #pragma omp task firstprivate(i) shared(t, frontier)
+            taskSolveBranch(&t, frontierTask(&frontier, i));
+        }
+    }
+    frontierFree(&frontier);
+    int found = atomic_load(&t.found);
+    if (found) *solution = t.solution;
+    return found;
+}
+
+#endif
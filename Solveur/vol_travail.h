@@ -0,0 +1,285 @@
+#ifndef SUDOKU_VOL_TRAVAIL_H
+#define SUDOKU_VOL_TRAVAIL_H
+
+// Ordonnanceur à vol de travail pour la recherche sur une seule grille.
+//
+// Chaque thread explore sa branche en profondeur avec une pile de niveaux
+// légère (case du choix, chiffre exploré, candidats restants), comme
+// stackSearchRun : aucune grille n'est copiée à chaque nœud. Seule la grille
+// de départ de la branche (root) est conservée. Un thread inoccupé vole tous
+// les candidats restants du niveau ouvert le plus ancien (le plus proche de
+// la racine, donc en général le plus gros sous-arbre) d'un autre thread, et
+// reconstruit lui-même la grille de ce niveau en rejouant depuis root les
+// choix des niveaux précédents (la propagation est déterministe). Les tâches
+// de la frontière (frontiere.h) servent de travail initial, distribué par une
+// file partagée.
+//
+// À inclure uniquement dans les programmes compilés avec -fopenmp.
+
+#include <omp.h>
+#include <stdlib.h>
+#include "solveur.h"
+#include "frontiere.h"
+
+typedef struct {
+    CellIndex cell;           // Case du choix
+    uint8_t digit;            // Chiffre exploré actuellement
+    Mask remaining;           // Candidats ni explorés ni volés
+} StealFrame;
+
+// État d'un thread visible des voleurs : protégé par lock (le propriétaire ne
+// le prend qu'en ajoutant un niveau ou en changeant de candidat)
+typedef struct {
+    omp_lock_t lock;
+    atomic_int depth;         // Niveaux dans frames (lu sans verrou par les voleurs)
+    Board root;               // Départ de la branche en cours, propagé
+    StealFrame frames[NN];
+} __attribute__((aligned(64))) StealWorker;
+
+typedef struct {
+    StealWorker *workers;
+    int numThreads;
+    Frontier *frontier;       // Travail initial
+    int next;                 // Prochaine tâche de la frontière à distribuer
+    int idle;                 // Threads sans travail
+    atomic_int found;         // Drapeau d'arrêt : une solution a été trouvée
+    SolverBackend backend;
+    Board solution;
+} StealScheduler;
+
+// Branche volée : grille du niveau volé et candidats de sa case
+typedef struct {
+    Board board;
+    int cell;
+    Mask candidates;
+} StolenBranch;
+
+static inline int stealFound(StealScheduler *s) {
+    return atomic_load_explicit(&s->found, memory_order_relaxed);
+}
+
+static inline void stealRecord(StealScheduler *s, const Board *b) {
+    #pragma omp critical(steal_solution)
+    {
+        if (!atomic_load(&s->found)) {
+            s->solution = *b;
+            atomic_store(&s->found, 1);
+        }
+    }
+}
+
+// Un voleur prend les candidats restants du niveau ouvert le plus ancien de
+// v. Le compteur de threads inoccupés est décrémenté sous le verrou de la
+// victime : il ne peut donc pas atteindre numThreads tant qu'une branche est
+// en transit.
+static inline int stealFrom(StealWorker *v, StolenBranch *out, int *idle) {
+    if (atomic_load_explicit(&v->depth, memory_order_relaxed) == 0) return 0;  // Évite le verrou
+
+    StealFrame path[NN];
+    int level = -1;
+    omp_set_lock(&v->lock);
+    int depth = atomic_load_explicit(&v->depth, memory_order_relaxed);
+    for (int k = 0; k < depth; k++)
+        if (v->frames[k].remaining) {
+            level = k;
+            break;
+        }
+    if (level >= 0) {
+        out->board = v->root;
+        memcpy(path, v->frames, level * sizeof(StealFrame));
+        out->cell = v->frames[level].cell;
+        out->candidates = v->frames[level].remaining;
+        v->frames[level].remaining = 0;
+        #pragma omp atomic
+        (*idle)--;
+    }
+    omp_unset_lock(&v->lock);
+    if (level < 0) return 0;
+
+    // Grille du niveau volé : choix des niveaux précédents rejoués depuis la
+    // racine, hors verrou (ils ont réussi chez la victime)
+    for (int k = 0; k < level; k++) {
+        boardAssign(&out->board, path[k].cell, path[k].digit);
+        boardPropagate(&out->board);
+    }
+    return 1;
+}
+
+// Installe la branche (root et premier niveau) dans l'état du thread
+static inline void stealPublish(StealWorker *w, const Board *root, int cell, int digit, Mask remaining) {
+    omp_set_lock(&w->lock);
+    w->root = *root;
+    w->frames[0].cell = (CellIndex)cell;
+    w->frames[0].digit = (uint8_t)digit;
+    w->frames[0].remaining = remaining;
+    atomic_store_explicit(&w->depth, 1, memory_order_relaxed);
+    omp_unset_lock(&w->lock);
+}
+
+// Explore en profondeur la branche du candidat d de la case cell de root
+// (grille propagée), ses autres candidats other restant à la disposition des
+// voleurs
+static inline void stealExplore(StealScheduler *s, int me, const Board *root, int cell, Mask candidates) {
+    StealWorker *w = &s->workers[me];
+    CellIndex marks[NN];      // numEmpty avant le choix de chaque niveau
+    Board b = *root;
+    int d = lowestDigit(candidates);
+    stealPublish(w, root, cell, d, candidates & (candidates - 1));
+    marks[0] = (CellIndex)b.numEmpty;
+    boardAssign(&b, cell, d);
+    int depth = 1, descend = 1;
+    for (;;) {
+        if (descend) {
+            if (stealFound(s)) break;
+            STAT_ADD(nodes, 1);
+            STAT_DEPTH(depth);
+            descend = 0;
+            if (boardPropagate(&b)) {
+                if (b.numEmpty == 0) {
+                    stealRecord(s, &b);
+                    break;
+                }
+                cell = boardPickMRV(&b);
+                candidates = boardCandidates(&b, cell);
+                d = lowestDigit(candidates);
+                marks[depth] = (CellIndex)b.numEmpty;
+                omp_set_lock(&w->lock);
+                w->frames[depth].cell = (CellIndex)cell;
+                w->frames[depth].digit = (uint8_t)d;
+                w->frames[depth].remaining = candidates & (candidates - 1);
+                atomic_store_explicit(&w->depth, ++depth, memory_order_relaxed);
+                omp_unset_lock(&w->lock);
+                boardAssign(&b, cell, d);
+                descend = 1;
+                continue;
+            }
+            STAT_ADD(backtracks, 1);
+        }
+
+        // Candidat suivant du niveau le plus profond (certains ont pu être volés)
+        omp_set_lock(&w->lock);
+        while (depth > 0 && w->frames[depth - 1].remaining == 0) depth--;
+        atomic_store_explicit(&w->depth, depth, memory_order_relaxed);
+        if (depth == 0) {
+            omp_unset_lock(&w->lock);
+            return;
+        }
+        StealFrame *f = &w->frames[depth - 1];
+        d = lowestDigit(f->remaining);
+        f->remaining &= f->remaining - 1;
+        f->digit = (uint8_t)d;
+        cell = f->cell;
+        omp_unset_lock(&w->lock);
+        boardUndo(&b, marks[depth - 1]);
+        boardAssign(&b, cell, d);
+        descend = 1;
+    }
+    // Solution trouvée : plus rien à voler chez ce thread
+    omp_set_lock(&w->lock);
+    atomic_store_explicit(&w->depth, 0, memory_order_relaxed);
+    omp_unset_lock(&w->lock);
+}
+
+// Résout une tâche de la frontière : propagation, puis exploration à partir
+// de sa première case de choix
+static inline void stealExploreTask(StealScheduler *s, int me, Board *task) {
+    if (s->backend != BACKEND_BACKTRACK) {
+        // Les autres moteurs ne se découpent pas : la tâche est résolue d'un
+        // bloc, en s'arrêtant si un autre thread trouve la solution
+        SearchControl ctl;
+        searchInit(&ctl, &s->found);
+        if (boardSolveWith(task, s->backend, &ctl)) stealRecord(s, task);
+        return;
+    }
+    STAT_ADD(nodes, 1);
+    if (!boardPropagate(task)) {
+        STAT_ADD(backtracks, 1);
+        return;
+    }
+    if (task->numEmpty == 0) {
+        stealRecord(s, task);
+        return;
+    }
+    int cell = boardPickMRV(task);
+    stealExplore(s, me, task, cell, boardCandidates(task, cell));
+}
+
+// Prochaine tâche de la frontière partagée
+static inline int stealNextInitial(StealScheduler *s, Board *out) {
+    int i;
+    #pragma omp atomic capture
+    i = s->next++;
+    if (i >= frontierCount(s->frontier)) return 0;
+    *out = *frontierTask(s->frontier, i);
+    return 1;
+}
+
+// Cherche du travail chez les autres threads. Renvoie 0 quand tous les threads
+// sont inoccupés (recherche épuisée) ou qu'une solution a été trouvée.
+static inline int stealWork(StealScheduler *s, int me, StolenBranch *out) {
+    #pragma omp atomic
+    s->idle++;
+    for (;;) {
+        int idle;
+        #pragma omp atomic read
+        idle = s->idle;
+        if (idle == s->numThreads || stealFound(s)) return 0;
+        for (int k = 1; k < s->numThreads; k++) {
+            int victim = (me + k) % s->numThreads;
+            if (stealFrom(&s->workers[victim], out, &s->idle)) return 1;
+        }
+    }
+}
+
+// Résout les tâches de la frontière avec numThreads threads. Renvoie 1 et
+// remplit solution si une solution a été trouvée, -1 si la mémoire manque.
+static inline int stealSolve(Frontier *frontier, SolverBackend backend, int numThreads, Board *solution) {
+    StealScheduler s;
+    s.numThreads = numThreads;
+    s.frontier = frontier;
+    s.next = 0;
+    s.idle = 0;
+    atomic_init(&s.found, 0);
+    s.backend = backend;
+    s.workers = aligned_alloc(64, numThreads * sizeof(StealWorker));
+    if (!s.workers) return -1;
+    for (int t = 0; t < numThreads; t++) {
+        omp_init_lock(&s.workers[t].lock);
+        atomic_init(&s.workers[t].depth, 0);
+    }
+
+    #pragma omp parallel num_threads(numThreads)
+    {
+        // L'équipe peut être plus petite que demandé (région imbriquée)
+        #pragma omp single
+        s.numThreads = omp_get_num_threads();
+
+        int me = omp_get_thread_num();
+        Board task;
+        StolenBranch stolen;
+        for (;;) {
+            if (stealNextInitial(&s, &task)) {
+                STAT_CLOCK(busyStart);
+                stealExploreTask(&s, me, &task);
+                STAT_ELAPSED(busy, busyStart);
+                continue;
+            }
+            STAT_CLOCK(stealStart);
+            int ok = stealWork(&s, me, &stolen);
+            STAT_ELAPSED(steal, stealStart);
+            if (!ok) break;
+            STAT_CLOCK(busyStart);
+            stealExplore(&s, me, &stolen.board, stolen.cell, stolen.candidates);
+            STAT_ELAPSED(busy, busyStart);
+        }
+    }
+
+    for (int t = 0; t < numThreads; t++)
+        omp_destroy_lock(&s.workers[t].lock);
+    free(s.workers);
+    int found = atomic_load(&s.found);
+    if (found) *solution = s.solution;
+    return found;
+}
+
+#endif